@@ -1422,7 +1422,7 @@ static NTSTATUS key_symmetric_encrypt( struct key *key,  UCHAR *input, ULONG inp
     struct key_symmetric_set_auth_data_params auth_params;
     struct key_symmetric_encrypt_params encrypt_params;
     struct key_symmetric_get_tag_params tag_params;
-    ULONG bytes_left = input_len;
+    ULONG bytes_left = input_len, chunk_len;
     UCHAR *buf;
     NTSTATUS status;
 
@@ -1475,21 +1475,26 @@ static NTSTATUS key_symmetric_encrypt( struct key *key,  UCHAR *input, ULONG inp
     if (key->u.s.mode == CHAIN_MODE_ECB && iv) return STATUS_INVALID_PARAMETER;
     if ((status = key_symmetric_set_vector( key, iv, iv_len, flags & BCRYPT_BLOCK_PADDING ))) return status;
 
+    /* ECB is emulated with a reset vector for each block, other modes can process all full blocks at once */
+    chunk_len = key->u.s.mode == CHAIN_MODE_ECB ? key->u.s.block_size : bytes_left & ~(key->u.s.block_size - 1);
+
     encrypt_params.key = key;
     encrypt_params.input = input;
-    encrypt_params.input_len = key->u.s.block_size;
+    encrypt_params.input_len = chunk_len;
     encrypt_params.output = output;
-    encrypt_params.output_len = key->u.s.block_size;
-    while (bytes_left >= key->u.s.block_size)
+    encrypt_params.output_len = chunk_len;
+    while (chunk_len && bytes_left >= chunk_len)
     {
         if ((status = UNIX_CALL( key_symmetric_encrypt, &encrypt_params )))
             return status;
         if (key->u.s.mode == CHAIN_MODE_ECB && (status = key_symmetric_set_vector( key, NULL, 0, TRUE )))
             return status;
-        bytes_left -= key->u.s.block_size;
-        encrypt_params.input += key->u.s.block_size;
-        encrypt_params.output += key->u.s.block_size;
+        bytes_left -= chunk_len;
+        encrypt_params.input += chunk_len;
+        encrypt_params.output += chunk_len;
     }
+    encrypt_params.input_len = key->u.s.block_size;
+    encrypt_params.output_len = key->u.s.block_size;
 
     if (flags & BCRYPT_BLOCK_PADDING)
     {
@@ -1520,7 +1525,7 @@ static NTSTATUS key_symmetric_decrypt( struct key *key, UCHAR *input, ULONG inpu
     struct key_symmetric_set_auth_data_params auth_params;
     struct key_symmetric_decrypt_params decrypt_params;
     struct key_symmetric_get_tag_params tag_params;
-    ULONG bytes_left = input_len;
+    ULONG bytes_left = input_len, chunk_len;
     NTSTATUS status;
 
     if (key->u.s.mode == CHAIN_MODE_GCM)
@@ -1577,20 +1582,25 @@ static NTSTATUS key_symmetric_decrypt( struct key *key, UCHAR *input, ULONG inpu
     if (key->u.s.mode == CHAIN_MODE_ECB && iv) return STATUS_INVALID_PARAMETER;
     if ((status = key_symmetric_set_vector( key, iv, iv_len, flags & BCRYPT_BLOCK_PADDING ))) return status;
 
+    /* ECB is emulated with a reset vector for each block, other modes can process all full blocks at once */
+    chunk_len = key->u.s.mode == CHAIN_MODE_ECB ? key->u.s.block_size : bytes_left & ~(key->u.s.block_size - 1);
+
     decrypt_params.key = key;
     decrypt_params.input = input;
-    decrypt_params.input_len = key->u.s.block_size;
+    decrypt_params.input_len = chunk_len;
     decrypt_params.output = output;
-    decrypt_params.output_len = key->u.s.block_size;
-    while (bytes_left >= key->u.s.block_size)
+    decrypt_params.output_len = chunk_len;
+    while (chunk_len && bytes_left >= chunk_len)
     {
         if ((status = UNIX_CALL( key_symmetric_decrypt, &decrypt_params ))) return status;
         if (key->u.s.mode == CHAIN_MODE_ECB && (status = key_symmetric_set_vector( key, NULL, 0, TRUE )))
             return status;
-        bytes_left -= key->u.s.block_size;
-        decrypt_params.input += key->u.s.block_size;
-        decrypt_params.output += key->u.s.block_size;
+        bytes_left -= chunk_len;
+        decrypt_params.input += chunk_len;
+        decrypt_params.output += chunk_len;
     }
+    decrypt_params.input_len = key->u.s.block_size;
+    decrypt_params.output_len = key->u.s.block_size;
 
     if (flags & BCRYPT_BLOCK_PADDING)
     {
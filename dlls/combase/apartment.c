@@ -743,6 +743,11 @@ static BOOL get_object_dll_path(const struct class_reg_data *regdata, WCHAR *dst
         }
         return !ret;
     }
+    else if (regdata->origin == CLASS_REG_CACHE)
+    {
+        lstrcpynW(dst, regdata->u.cache.dll_path, dstlen);
+        return *dst != 0;
+    }
     else
     {
         ULONG_PTR cookie;
@@ -1024,10 +1029,162 @@ static enum comclass_threadingmodel get_threading_model(const struct class_reg_d
         if (threading_model[0]) return ThreadingModel_Neutral;
         return ThreadingModel_No;
     }
+    else if (data->origin == CLASS_REG_CACHE)
+        return data->u.cache.threading_model;
     else
         return data->u.actctx.threading_model;
 }
 
+/* Process-wide cache of the InprocServer32 and InprocHandler32 registrations,
+ * flushed whenever anything below HKCR changes. */
+struct class_reg_cache_entry
+{
+    struct list entry;
+    CLSID clsid;
+    BOOL handler;
+    HRESULT hr;
+    DWORD threading_model;
+    WCHAR dll_path[MAX_PATH + 1];
+};
+
+#define CLASS_REG_CACHE_SIZE 256
+
+static struct list class_reg_cache = LIST_INIT(class_reg_cache);
+static unsigned int class_reg_cache_count;
+static HANDLE class_reg_cache_event;
+static BOOL class_reg_cache_disabled;
+
+static CRITICAL_SECTION class_reg_cache_cs;
+static CRITICAL_SECTION_DEBUG class_reg_cache_cs_debug =
+{
+    0, 0, &class_reg_cache_cs,
+    { &class_reg_cache_cs_debug.ProcessLocksList, &class_reg_cache_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": class_reg_cache_cs") }
+};
+static CRITICAL_SECTION class_reg_cache_cs = { &class_reg_cache_cs_debug, -1, 0, 0, 0, 0 };
+
+static void class_reg_cache_flush(void)
+{
+    struct class_reg_cache_entry *cached, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE(cached, next, &class_reg_cache, struct class_reg_cache_entry, entry)
+    {
+        list_remove(&cached->entry);
+        free(cached);
+    }
+    class_reg_cache_count = 0;
+}
+
+/* caller must hold class_reg_cache_cs */
+static BOOL class_reg_cache_validate(void)
+{
+    if (class_reg_cache_disabled) return FALSE;
+
+    if (class_reg_cache_event && WaitForSingleObject(class_reg_cache_event, 0) == WAIT_TIMEOUT)
+        return TRUE;
+
+    class_reg_cache_flush();
+    if (!class_reg_cache_event && !(class_reg_cache_event = CreateEventW(NULL, FALSE, FALSE, NULL)))
+    {
+        class_reg_cache_disabled = TRUE;
+        return FALSE;
+    }
+    if (RegNotifyChangeKeyValue(HKEY_CLASSES_ROOT, TRUE, REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET,
+            class_reg_cache_event, TRUE))
+    {
+        WARN("failed to watch HKCR, not caching class registrations\n");
+        class_reg_cache_disabled = TRUE;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static BOOL class_reg_cache_lookup(REFCLSID rclsid, BOOL handler, struct class_reg_data *regdata, HRESULT *hr)
+{
+    struct class_reg_cache_entry *cached;
+    BOOL ret = FALSE;
+
+    EnterCriticalSection(&class_reg_cache_cs);
+    if (class_reg_cache_validate())
+    {
+        LIST_FOR_EACH_ENTRY(cached, &class_reg_cache, struct class_reg_cache_entry, entry)
+        {
+            if (cached->handler != handler || !IsEqualCLSID(&cached->clsid, rclsid)) continue;
+
+            list_remove(&cached->entry);
+            list_add_head(&class_reg_cache, &cached->entry);
+            regdata->origin = CLASS_REG_CACHE;
+            regdata->u.cache.threading_model = cached->threading_model;
+            lstrcpyW(regdata->u.cache.dll_path, cached->dll_path);
+            *hr = cached->hr;
+            ret = TRUE;
+            break;
+        }
+    }
+    LeaveCriticalSection(&class_reg_cache_cs);
+
+    return ret;
+}
+
+static void class_reg_cache_add(REFCLSID rclsid, BOOL handler, const struct class_reg_data *regdata, HRESULT hr)
+{
+    struct class_reg_cache_entry *cached;
+
+    if (!(cached = calloc(1, sizeof(*cached)))) return;
+    cached->clsid = *rclsid;
+    cached->handler = handler;
+    cached->hr = hr;
+    if (SUCCEEDED(hr))
+    {
+        cached->threading_model = regdata->u.cache.threading_model;
+        lstrcpyW(cached->dll_path, regdata->u.cache.dll_path);
+    }
+
+    EnterCriticalSection(&class_reg_cache_cs);
+    if (class_reg_cache_disabled)
+    {
+        free(cached);
+    }
+    else
+    {
+        list_add_head(&class_reg_cache, &cached->entry);
+        if (++class_reg_cache_count > CLASS_REG_CACHE_SIZE)
+        {
+            cached = LIST_ENTRY(list_tail(&class_reg_cache), struct class_reg_cache_entry, entry);
+            list_remove(&cached->entry);
+            free(cached);
+            class_reg_cache_count--;
+        }
+    }
+    LeaveCriticalSection(&class_reg_cache_cs);
+}
+
+/* Resolves the in-process server or handler registration of a class. */
+HRESULT apartment_get_class_reg_data(REFCLSID rclsid, BOOL handler, struct class_reg_data *regdata)
+{
+    struct class_reg_data key_data;
+    HRESULT hr;
+    HKEY hkey;
+
+    if (class_reg_cache_lookup(rclsid, handler, regdata, &hr))
+        return hr;
+
+    hr = open_key_for_clsid(rclsid, handler ? L"InprocHandler32" : L"InprocServer32", KEY_READ, &hkey);
+    if (SUCCEEDED(hr))
+    {
+        key_data.origin = CLASS_REG_REGISTRY;
+        key_data.u.hkey = hkey;
+        regdata->origin = CLASS_REG_CACHE;
+        regdata->u.cache.threading_model = get_threading_model(&key_data);
+        if (!get_object_dll_path(&key_data, regdata->u.cache.dll_path, ARRAY_SIZE(regdata->u.cache.dll_path)))
+            regdata->u.cache.dll_path[0] = 0;
+        RegCloseKey(hkey);
+    }
+
+    class_reg_cache_add(rclsid, handler, regdata, hr);
+    return hr;
+}
+
 HRESULT apartment_get_inproc_class_object(struct apartment *apt, const struct class_reg_data *regdata,
         REFCLSID rclsid, REFIID riid, DWORD class_context, void **ppv)
 {
@@ -1291,6 +1448,9 @@ void apartment_global_cleanup(void)
     if (apt_win_class)
         UnregisterClassW((const WCHAR *)MAKEINTATOM(apt_win_class), hProxyDll);
     apartment_release_dlls();
+    class_reg_cache_flush();
+    if (class_reg_cache_event) CloseHandle(class_reg_cache_event);
+    DeleteCriticalSection(&class_reg_cache_cs);
     DeleteCriticalSection(&apt_cs);
 }
 
@@ -1770,9 +1770,7 @@ static HRESULT com_get_class_object(REFCLSID rclsid, DWORD clscontext,
     /* First try in-process server */
     if (clscontext & CLSCTX_INPROC_SERVER)
     {
-        HKEY hkey;
-
-        hr = open_key_for_clsid(rclsid, L"InprocServer32", KEY_READ, &hkey);
+        hr = apartment_get_class_reg_data(rclsid, FALSE, &clsreg);
         if (FAILED(hr))
         {
             if (hr == REGDB_E_CLASSNOTREG)
@@ -1785,13 +1783,7 @@ static HRESULT com_get_class_object(REFCLSID rclsid, DWORD clscontext,
         }
 
         if (SUCCEEDED(hr))
-        {
-            clsreg.u.hkey = hkey;
-            clsreg.origin = CLASS_REG_REGISTRY;
-
             hr = apartment_get_inproc_class_object(apt, &clsreg, rclsid, riid, clscontext, obj);
-            RegCloseKey(hkey);
-        }
 
         /* return if we got a class, otherwise fall through to one of the
          * other types */
@@ -1805,9 +1797,7 @@ static HRESULT com_get_class_object(REFCLSID rclsid, DWORD clscontext,
     /* Next try in-process handler */
     if (clscontext & CLSCTX_INPROC_HANDLER)
     {
-        HKEY hkey;
-
-        hr = open_key_for_clsid(rclsid, L"InprocHandler32", KEY_READ, &hkey);
+        hr = apartment_get_class_reg_data(rclsid, TRUE, &clsreg);
         if (FAILED(hr))
         {
             if (hr == REGDB_E_CLASSNOTREG)
@@ -1820,13 +1810,7 @@ static HRESULT com_get_class_object(REFCLSID rclsid, DWORD clscontext,
         }
 
         if (SUCCEEDED(hr))
-        {
-            clsreg.u.hkey = hkey;
-            clsreg.origin = CLASS_REG_REGISTRY;
-
             hr = apartment_get_inproc_class_object(apt, &clsreg, rclsid, riid, clscontext, obj);
-            RegCloseKey(hkey);
-        }
 
         /* return if we got a class, otherwise fall through to one of the
          * other types */
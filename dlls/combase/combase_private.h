@@ -139,6 +139,7 @@ enum class_reg_data_origin
 {
     CLASS_REG_ACTCTX,
     CLASS_REG_REGISTRY,
+    CLASS_REG_CACHE,
 };
 
 struct class_reg_data
@@ -153,6 +154,11 @@ struct class_reg_data
             HANDLE hactctx;
         } actctx;
         HKEY hkey;
+        struct
+        {
+            DWORD threading_model;
+            WCHAR dll_path[MAX_PATH + 1];
+        } cache;
     } u;
 };
 
@@ -164,6 +170,7 @@ HRESULT apartment_increment_mta_usage(CO_MTA_USAGE_COOKIE *cookie);
 void apartment_decrement_mta_usage(CO_MTA_USAGE_COOKIE cookie);
 HRESULT ensure_mta(void);
 struct apartment * apartment_get_mta(void);
+HRESULT apartment_get_class_reg_data(REFCLSID rclsid, BOOL handler, struct class_reg_data *regdata);
 HRESULT apartment_get_inproc_class_object(struct apartment *apt, const struct class_reg_data *regdata,
         REFCLSID rclsid, REFIID riid, DWORD class_context, void **ppv);
 HRESULT apartment_get_local_server_stream(struct apartment *apt, IStream **ret);
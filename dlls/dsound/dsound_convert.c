@@ -36,6 +36,7 @@
 
 
 #include <stdarg.h>
+#include <string.h>
 #include <math.h>
 
 #include "windef.h"
@@ -99,6 +100,67 @@ static float getieee32(const IDirectSoundBufferImpl *dsb, BYTE *base, DWORD chan
 
 const bitsgetfunc getbpp[5] = {get8, get16, get24, get32, getieee32};
 
+/* Block versions of the above, converting count samples of a single channel.
+ * The source stride is in bytes, the destination stride in floats. */
+
+static void get8_block(const BYTE *src, UINT src_stride, float *dst, UINT dst_stride, UINT count)
+{
+    while (count--)
+    {
+        *dst = (*src - 0x80) * (1.0f / 0x80);
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+static void get16_block(const BYTE *src, UINT src_stride, float *dst, UINT dst_stride, UINT count)
+{
+    while (count--)
+    {
+        *dst = (SHORT)le16(*(const SHORT *)src) * (1.0f / 0x8000);
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+static void get24_block(const BYTE *src, UINT src_stride, float *dst, UINT dst_stride, UINT count)
+{
+    while (count--)
+    {
+        LONG sample = (src[0] << 8) | (src[1] << 16) | (src[2] << 24);
+        *dst = sample * (1.0f / 0x80000000U);
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+static void get32_block(const BYTE *src, UINT src_stride, float *dst, UINT dst_stride, UINT count)
+{
+    while (count--)
+    {
+        *dst = (LONG)le32(*(const LONG *)src) * (1.0f / 0x80000000U);
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+static void getieee32_block(const BYTE *src, UINT src_stride, float *dst, UINT dst_stride, UINT count)
+{
+    if (src_stride == sizeof(float) && dst_stride == 1)
+    {
+        memcpy(dst, src, count * sizeof(float));
+        return;
+    }
+    while (count--)
+    {
+        *dst = *(const float *)src;
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+const bitsgetblockfunc getbpp_block[5] = {get8_block, get16_block, get24_block, get32_block, getieee32_block};
+
 float get_mono(const IDirectSoundBufferImpl *dsb, BYTE *base, DWORD channel)
 {
     DWORD channels = dsb->pwfx->nChannels;
@@ -321,11 +383,13 @@ void put_quad2stereo(const IDirectSoundBufferImpl *dsb, DWORD pos, DWORD channel
     }
 }
 
-void mixieee32(float *src, float *dst, unsigned samples)
+void mixieee32(const float *src, float *dst, unsigned samples)
 {
+    unsigned i;
+
     TRACE("%p - %p %d\n", src, dst, samples);
-    while (samples--)
-        *(dst++) += *(src++);
+    for (i = 0; i < samples; i++)
+        dst[i] += src[i];
 }
 
 static void norm8(float *src, unsigned char *dst, unsigned samples)
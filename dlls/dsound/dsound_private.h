@@ -45,10 +45,12 @@ typedef struct DirectSoundDevice             DirectSoundDevice;
 /* dsound_convert.h */
 typedef float (*bitsgetfunc)(const IDirectSoundBufferImpl *, BYTE *, DWORD);
 typedef void (*bitsputfunc)(const IDirectSoundBufferImpl *, DWORD, DWORD, float);
+typedef void (*bitsgetblockfunc)(const BYTE *, UINT, float *, UINT, UINT);
 extern const bitsgetfunc getbpp[5];
+extern const bitsgetblockfunc getbpp_block[5];
 void putieee32(const IDirectSoundBufferImpl *dsb, DWORD pos, DWORD channel, float value);
 void putieee32_sum(const IDirectSoundBufferImpl *dsb, DWORD pos, DWORD channel, float value);
-void mixieee32(float *src, float *dst, unsigned samples);
+void mixieee32(const float *src, float *dst, unsigned samples);
 typedef void (*normfunc)(const void *, void *, unsigned);
 extern const normfunc normfunctions[4];
 
@@ -170,6 +172,7 @@ struct IDirectSoundBufferImpl
     /* Used for bit depth conversion */
     int                         mix_channels;
     bitsgetfunc get, get_aux;
+    bitsgetblockfunc get_block; /* NULL if samples can't be copied one channel at a time */
     bitsputfunc put, put_aux;
     int                         num_filters;
     DSFilter*                   filters;
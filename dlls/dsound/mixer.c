@@ -139,6 +139,7 @@ void DSOUND_RecalcFormat(IDirectSoundBufferImpl *dsb)
 	dsb->put_aux = putieee32;
 
 	dsb->get = dsb->get_aux;
+	dsb->get_block = ieee ? getbpp_block[4] : getbpp_block[dsb->pwfx->wBitsPerSample/8 - 1];
 	dsb->put = dsb->put_aux;
 
 	if (ichannels == ochannels)
@@ -164,6 +165,7 @@ void DSOUND_RecalcFormat(IDirectSoundBufferImpl *dsb)
 	{
 		dsb->mix_channels = 1;
 		dsb->get = get_mono;
+		dsb->get_block = NULL;
 	}
 	else if (ichannels == 2 && ochannels == 4)
 	{
@@ -286,10 +288,55 @@ static inline float get_current_sample(const IDirectSoundBufferImpl *dsb,
     return dsb->get(dsb, buffer + (mixpos % buflen), channel);
 }
 
+/**
+ * Convert count samples of one channel, starting at mixpos, into dst.
+ * Contiguous runs of the secondary buffer are converted as a block,
+ * which lets the compiler vectorize the format conversion.
+ *
+ * dst_stride = distance between two output samples, in floats
+ */
+static void get_current_samples(const IDirectSoundBufferImpl *dsb, BYTE *buffer, DWORD buflen,
+        DWORD mixpos, DWORD channel, float *dst, UINT dst_stride, UINT count)
+{
+    UINT istride = dsb->pwfx->nBlockAlign;
+    UINT offset = channel * (dsb->pwfx->wBitsPerSample / 8);
+    UINT n;
+
+    if (!dsb->get_block) {
+        for (; count; count--, mixpos += istride, dst += dst_stride)
+            *dst = get_current_sample(dsb, buffer, buflen, mixpos, channel);
+        return;
+    }
+
+    while (count) {
+        if (mixpos >= buflen) {
+            if (!(dsb->playflags & DSBPLAY_LOOPING)) {
+                for (; count; count--, dst += dst_stride)
+                    *dst = 0.0f;
+                return;
+            }
+            mixpos %= buflen;
+        }
+
+        if (!(n = min(count, (buflen - mixpos) / istride))) {
+            /* partial frame at the end of the buffer */
+            *dst = get_current_sample(dsb, buffer, buflen, mixpos, channel);
+            n = 1;
+        }
+        else
+            dsb->get_block(buffer + mixpos + offset, istride, dst, dst_stride, n);
+
+        count -= n;
+        mixpos += n * istride;
+        dst += n * dst_stride;
+    }
+}
+
 static UINT cp_fields_noresample(IDirectSoundBufferImpl *dsb, UINT count)
 {
     UINT istride = dsb->pwfx->nBlockAlign;
-    UINT ostride = dsb->device->pwfx->nChannels * sizeof(float);
+    UINT ochannels = dsb->device->pwfx->nChannels;
+    UINT ostride = ochannels * sizeof(float);
     UINT committed_samples = 0;
     DWORD channel, i;
 
@@ -301,6 +348,20 @@ static UINT cp_fields_noresample(IDirectSoundBufferImpl *dsb, UINT count)
         committed_samples = committed_samples <= count ? committed_samples : count;
     }
 
+    if (dsb->put == putieee32 && dsb->get_block) {
+        /* straight copy, convert directly into the interleaved temporary buffer */
+        float *obuf = dsb->device->tmp_buffer;
+
+        for (channel = 0; channel < dsb->mix_channels; channel++) {
+            get_current_samples(dsb, dsb->committedbuff, dsb->writelead, dsb->committed_mixpos,
+                    channel, obuf + channel, ochannels, committed_samples);
+            get_current_samples(dsb, dsb->buffer->memory, dsb->buflen,
+                    dsb->sec_mixpos + committed_samples * istride, channel,
+                    obuf + committed_samples * ochannels + channel, ochannels, count - committed_samples);
+        }
+        return count;
+    }
+
     for (i = 0; i < committed_samples; i++)
         for (channel = 0; channel < dsb->mix_channels; channel++)
             dsb->put(dsb, i * ostride, channel, get_current_sample(dsb, dsb->committedbuff,
@@ -314,12 +375,34 @@ static UINT cp_fields_noresample(IDirectSoundBufferImpl *dsb, UINT count)
     return count;
 }
 
+/* Four independent partial sums, so that the loop can be vectorized. */
+static inline float fir_dot_product(const float *coeffs, const float *samples, int count)
+{
+    float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    int j;
+
+    for (j = 0; j + 4 <= count; j += 4) {
+        sum0 += coeffs[j] * samples[j];
+        sum1 += coeffs[j + 1] * samples[j + 1];
+        sum2 += coeffs[j + 2] * samples[j + 2];
+        sum3 += coeffs[j + 3] * samples[j + 3];
+    }
+    for (; j < count; j++)
+        sum0 += coeffs[j] * samples[j];
+
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
 static UINT cp_fields_resample(IDirectSoundBufferImpl *dsb, UINT count, LONG64 *freqAccNum)
 {
     UINT i, channel;
     UINT istride = dsb->pwfx->nBlockAlign;
-    UINT ostride = dsb->device->pwfx->nChannels * sizeof(float);
+    UINT ochannels = dsb->device->pwfx->nChannels;
+    UINT ostride = ochannels * sizeof(float);
     UINT committed_samples = 0;
+    BOOL put_direct = dsb->put == putieee32;
+    float firgain = dsb->firgain;
+    float *obuf;
 
     LONG64 freqAcc_start = *freqAccNum;
     LONG64 freqAcc_end = freqAcc_start + count * dsb->freqAdjustNum;
@@ -350,6 +433,7 @@ static UINT cp_fields_resample(IDirectSoundBufferImpl *dsb, UINT count, LONG64 *
 
     fir_copy = dsb->device->cp_buffer;
     intermediate = fir_copy + fir_cachesize;
+    obuf = dsb->device->tmp_buffer;
 
     if(dsb->use_committed) {
         committed_samples = (dsb->writelead - dsb->committed_mixpos) / istride;
@@ -362,12 +446,12 @@ static UINT cp_fields_resample(IDirectSoundBufferImpl *dsb, UINT count, LONG64 *
      */
     itmp = intermediate;
     for (channel = 0; channel < channels; channel++) {
-        for (i = 0; i < committed_samples; i++)
-            *(itmp++) = get_current_sample(dsb, dsb->committedbuff,
-                dsb->writelead, dsb->committed_mixpos + i * istride, channel);
-        for (; i < required_input; i++)
-            *(itmp++) = get_current_sample(dsb, dsb->buffer->memory,
-                    dsb->buflen, dsb->sec_mixpos + i * istride, channel);
+        get_current_samples(dsb, dsb->committedbuff, dsb->writelead, dsb->committed_mixpos,
+                channel, itmp, 1, committed_samples);
+        get_current_samples(dsb, dsb->buffer->memory, dsb->buflen,
+                dsb->sec_mixpos + committed_samples * istride, channel,
+                itmp + committed_samples, 1, required_input - committed_samples);
+        itmp += required_input;
     }
 
     for(i = 0; i < count; ++i) {
@@ -376,24 +460,25 @@ static UINT cp_fields_resample(IDirectSoundBufferImpl *dsb, UINT count, LONG64 *
         UINT ipos = int_fir_steps / dsbfirstep;
 
         UINT idx = (ipos + 1) * dsbfirstep - int_fir_steps - 1;
-        float rem = int_fir_steps + 1.0 - total_fir_steps;
+        float rem = int_fir_steps + 1.0f - total_fir_steps;
+        float irem = 1.0f - rem;
 
         int fir_used = 0;
         while (idx < fir_len - 1) {
-            fir_copy[fir_used++] = fir[idx] * (1.0 - rem) + fir[idx + 1] * rem;
-            idx += dsb->firstep;
+            fir_copy[fir_used++] = fir[idx] * irem + fir[idx + 1] * rem;
+            idx += dsbfirstep;
         }
 
         assert(fir_used <= fir_cachesize);
         assert(ipos + fir_used <= required_input);
 
-        for (channel = 0; channel < dsb->mix_channels; channel++) {
-            int j;
-            float sum = 0.0;
-            float* cache = &intermediate[channel * required_input + ipos];
-            for (j = 0; j < fir_used; j++)
-                sum += fir_copy[j] * cache[j];
-            dsb->put(dsb, i * ostride, channel, sum * dsb->firgain);
+        for (channel = 0; channel < channels; channel++) {
+            float sum = fir_dot_product(fir_copy, &intermediate[channel * required_input + ipos], fir_used);
+
+            if (put_direct)
+                obuf[i * ochannels + channel] = sum * firgain;
+            else
+                dsb->put(dsb, i * ostride, channel, sum * firgain);
         }
     }
 
@@ -509,9 +594,22 @@ static void DSOUND_MixerVol(const IDirectSoundBufferImpl *dsb, INT frames)
 	for (i = 0; i < channels; ++i)
 		vols[i] = dsb->volpan.dwTotalAmpFactor[i] / ((float)0xFFFF);
 
-	for(i = 0; i < frames; ++i){
-		for(chan = 0; chan < channels; ++chan){
-			dsb->device->tmp_buffer[i * channels + chan] *= vols[chan];
+	/* special case the common layouts, so that the loop can be vectorized */
+	if (channels == 1) {
+		float *buf = dsb->device->tmp_buffer, vol = vols[0];
+		for (i = 0; i < frames; ++i)
+			buf[i] *= vol;
+	} else if (channels == 2) {
+		float *buf = dsb->device->tmp_buffer, left = vols[0], right = vols[1];
+		for (i = 0; i < frames; ++i) {
+			buf[2 * i] *= left;
+			buf[2 * i + 1] *= right;
+		}
+	} else {
+		for(i = 0; i < frames; ++i){
+			for(chan = 0; chan < channels; ++chan){
+				dsb->device->tmp_buffer[i * channels + chan] *= vols[chan];
+			}
 		}
 	}
 }
@@ -449,7 +449,8 @@ static HRESULT compile_member_expression(compiler_ctx_t *ctx, member_expression_
     if(FAILED(hres))
         return hres;
 
-    return push_instr_bstr(ctx, OP_member, expr->identifier);
+    /* The name hash is computed once here rather than on every property access. */
+    return push_instr_bstr_uint(ctx, OP_member, expr->identifier, string_hash(expr->identifier));
 }
 
 #define LABEL_FLAG 0x80000000
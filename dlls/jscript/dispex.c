@@ -24,6 +24,7 @@
 #include "wine/debug.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(jscript);
+WINE_DECLARE_DEBUG_CHANNEL(jscript_gc);
 
 static const GUID GUID_JScriptTypeInfo = {0xc59c6b12,0xf6c1,0x11cf,{0x88,0x35,0x00,0xa0,0xc9,0x11,0xe8,0xb2}};
 
@@ -167,14 +168,6 @@ found:
     return This->builtin_info->props + i;
 }
 
-static inline unsigned string_hash(const WCHAR *name)
-{
-    unsigned h = 0;
-    for(; *name; name++)
-        h = (h>>(sizeof(unsigned)*8-4)) ^ (h<<4) ^ towlower(*name);
-    return h;
-}
-
 static inline unsigned get_props_idx(jsdisp_t *This, unsigned hash)
 {
     return (hash*GOLDEN_RATIO) & (This->buf_size-1);
@@ -919,6 +912,13 @@ static jsdisp_t *gc_stack_pop(struct gc_ctx *gc_ctx)
     return obj;
 }
 
+/* A collection walks every object, so don't run it implicitly unless a
+ * sizable number of objects were created since the last one. */
+static inline unsigned gc_alloc_threshold(struct thread_data *thread_data)
+{
+    return max(thread_data->gc_live_count / 4, 1024);
+}
+
 HRESULT gc_run(script_ctx_t *ctx)
 {
     /* Save original refcounts in a linked list of chunks */
@@ -931,7 +931,9 @@ HRESULT gc_run(script_ctx_t *ctx)
     jsdisp_t *obj, *obj2, *link, *link2;
     dispex_prop_t *prop, *props_end;
     struct gc_ctx gc_ctx = { 0 };
-    unsigned chunk_idx = 0;
+    unsigned chunk_idx = 0, obj_cnt = 0, unlink_cnt = 0;
+    LARGE_INTEGER start, mark_end, end, freq;
+    BOOL trace_gc = TRACE_ON(jscript_gc);
     HRESULT hres = S_OK;
     struct list *iter;
 
@@ -939,6 +941,9 @@ HRESULT gc_run(script_ctx_t *ctx)
     if(thread_data->gc_is_unlinking)
         return S_OK;
 
+    if(trace_gc)
+        QueryPerformanceCounter(&start);
+
     if(!(head = malloc(sizeof(*head))))
         return E_OUTOFMEMORY;
     head->next = NULL;
@@ -959,6 +964,7 @@ HRESULT gc_run(script_ctx_t *ctx)
             chunk->next = NULL;
         }
         chunk->ref[chunk_idx++] = obj->ref;
+        obj_cnt++;
     }
     LIST_FOR_EACH_ENTRY(obj, &thread_data->objects, jsdisp_t, entry) {
         /* Skip objects with external reference counter */
@@ -1089,6 +1095,9 @@ HRESULT gc_run(script_ctx_t *ctx)
     if(FAILED(hres))
         return hres;
 
+    if(trace_gc)
+        QueryPerformanceCounter(&mark_end);
+
     /* 3. Remove all the links from the marked objects, since they are dangling */
     thread_data->gc_is_unlinking = TRUE;
 
@@ -1103,6 +1112,7 @@ HRESULT gc_run(script_ctx_t *ctx)
         /* Grab it since it gets removed when unlinked */
         jsdisp_addref(obj);
         unlink_jsdisp(obj);
+        unlink_cnt++;
 
         /* Releasing unlinked object should not delete any other object,
            so we can safely obtain the next pointer now */
@@ -1112,6 +1122,19 @@ HRESULT gc_run(script_ctx_t *ctx)
 
     thread_data->gc_is_unlinking = FALSE;
     thread_data->gc_last_tick = GetTickCount();
+    thread_data->gc_alloc_count = 0;
+    thread_data->gc_live_count = obj_cnt - unlink_cnt;
+
+    if(trace_gc) {
+        QueryPerformanceCounter(&end);
+        QueryPerformanceFrequency(&freq);
+        if(end.QuadPart - start.QuadPart > thread_data->gc_max_pause)
+            thread_data->gc_max_pause = end.QuadPart - start.QuadPart;
+        TRACE_(jscript_gc)("unlinked %u of %u objects in %I64u us (mark %I64u us), max pause %I64u us\n",
+                unlink_cnt, obj_cnt, (end.QuadPart - start.QuadPart) * 1000000 / freq.QuadPart,
+                (mark_end.QuadPart - start.QuadPart) * 1000000 / freq.QuadPart,
+                thread_data->gc_max_pause * 1000000 / freq.QuadPart);
+    }
     return S_OK;
 }
 
@@ -2423,8 +2446,9 @@ HRESULT init_dispex(jsdisp_t *dispex, script_ctx_t *ctx, const builtin_info_t *b
 {
     unsigned i;
 
-    /* FIXME: Use better heuristics to decide when to run the GC */
-    if(GetTickCount() - ctx->thread_data->gc_last_tick > 30000)
+    /* FIXME: The collection is not incremental, so a large heap still causes long pauses */
+    if(++ctx->thread_data->gc_alloc_count > gc_alloc_threshold(ctx->thread_data)
+       && GetTickCount() - ctx->thread_data->gc_last_tick > 30000)
         gc_run(ctx);
 
     TRACE("%p (%p)\n", dispex, prototype);
@@ -2516,6 +2540,12 @@ jsdisp_t *iface_to_jsdisp(IDispatch *iface)
 }
 
 HRESULT jsdisp_get_id(jsdisp_t *jsdisp, const WCHAR *name, DWORD flags, DISPID *id)
+{
+    return jsdisp_get_id_hash(jsdisp, name, string_hash(name), flags, id);
+}
+
+/* Same as jsdisp_get_id, for callers that already know string_hash(name). */
+HRESULT jsdisp_get_id_hash(jsdisp_t *jsdisp, const WCHAR *name, unsigned hash, DWORD flags, DISPID *id)
 {
     dispex_prop_t *prop;
     HRESULT hres;
@@ -2524,7 +2554,7 @@ HRESULT jsdisp_get_id(jsdisp_t *jsdisp, const WCHAR *name, DWORD flags, DISPID *
         hres = ensure_prop_name(jsdisp, name, PROPF_ENUMERABLE | PROPF_CONFIGURABLE | PROPF_WRITABLE,
                                 flags & fdexNameCaseInsensitive, &prop);
     else
-        hres = find_prop_name_prot(jsdisp, string_hash(name), name, flags & fdexNameCaseInsensitive, NULL, &prop);
+        hres = find_prop_name_prot(jsdisp, hash, name, flags & fdexNameCaseInsensitive, NULL, &prop);
     if(FAILED(hres))
         return hres;
 
@@ -1432,6 +1432,8 @@ static HRESULT interp_array(script_ctx_t *ctx)
 static HRESULT interp_member(script_ctx_t *ctx)
 {
     const BSTR arg = get_op_bstr(ctx, 0);
+    const unsigned hash = get_op_uint(ctx, 1);
+    jsdisp_t *jsdisp;
     IDispatch *obj;
     jsval_t v;
     DISPID id;
@@ -1443,7 +1445,10 @@ static HRESULT interp_member(script_ctx_t *ctx)
     if(FAILED(hres))
         return hres;
 
-    hres = disp_get_id(ctx, obj, arg, arg, 0, &id);
+    if((jsdisp = to_jsdisp(obj)))
+        hres = jsdisp_get_id_hash(jsdisp, arg, hash, 0, &id);
+    else
+        hres = disp_get_id(ctx, obj, arg, arg, 0, &id);
     if(SUCCEEDED(hres)) {
         hres = disp_propget(ctx, obj, id, &v);
     }else if(hres == DISP_E_UNKNOWNNAME) {
@@ -133,6 +133,9 @@ struct thread_data {
 
     BOOL gc_is_unlinking;
     DWORD gc_last_tick;
+    unsigned gc_alloc_count;  /* objects created since the last collection */
+    unsigned gc_live_count;   /* objects left after the last collection */
+    ULONGLONG gc_max_pause;   /* longest collection so far, in performance counter ticks */
 
     struct list objects;
     struct rb_tree weak_refs;
@@ -259,6 +262,7 @@ HRESULT jsdisp_propput_idx(jsdisp_t*,DWORD,jsval_t);
 HRESULT jsdisp_propget_name(jsdisp_t*,LPCWSTR,jsval_t*);
 HRESULT jsdisp_get_idx(jsdisp_t*,DWORD,jsval_t*);
 HRESULT jsdisp_get_id(jsdisp_t*,const WCHAR*,DWORD,DISPID*);
+HRESULT jsdisp_get_id_hash(jsdisp_t*,const WCHAR*,unsigned,DWORD,DISPID*);
 HRESULT jsdisp_get_idx_id(jsdisp_t*,DWORD,DISPID*);
 HRESULT disp_delete(IDispatch*,DISPID,BOOL*);
 HRESULT disp_delete_name(script_ctx_t*,IDispatch*,jsstr_t*,BOOL*);
@@ -333,6 +337,14 @@ static inline BOOL is_digit(WCHAR c)
     return '0' <= c && c <= '9';
 }
 
+static inline unsigned string_hash(const WCHAR *name)
+{
+    unsigned h = 0;
+    for(; *name; name++)
+        h = (h>>(sizeof(unsigned)*8-4)) ^ (h<<4) ^ towlower(*name);
+    return h;
+}
+
 typedef struct _cc_var_t cc_var_t;
 
 typedef struct {
@@ -226,7 +226,7 @@ typedef struct _column_info
     struct _column_info *next;
 } column_info;
 
-typedef const struct tagMSICOLUMNHASHENTRY *MSIITERHANDLE;
+typedef const struct column_hash_entry *MSIITERHANDLE;
 
 typedef struct tagMSIVIEWOPS
 {
@@ -323,6 +323,19 @@ typedef struct tagMSIVIEWOPS
      */
     UINT (*delete)( struct tagMSIVIEW * );
 
+    /*
+     * find_matching_rows - iterates through rows that match a value
+     *
+     * If the column type is a string then a string ID should be passed in.
+     *  If the value to be looked up is an integer then it should be in the
+     *  form returned by fetch_int.
+     * The handle is an input/output parameter that keeps track of the current
+     *  position in the iteration. It must be initialised to zero before the
+     *  first call and continued to be passed in to subsequent calls.
+     * Rows are returned in ascending order.
+     */
+    UINT (*find_matching_rows)( struct tagMSIVIEW *view, UINT col, UINT val, UINT *row, MSIITERHANDLE *handle );
+
     /*
      * add_ref - increases the reference count of the table
      */
@@ -459,6 +459,7 @@ static const MSIVIEWOPS storages_ops =
     NULL,
     NULL,
     NULL,
+    NULL,
 };
 
 static INT add_storages_to_table(struct storages_view *sv)
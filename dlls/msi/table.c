@@ -55,6 +55,7 @@ struct column_info
     UINT    type;
     UINT    offset;
     struct column_hash_entry **hash_table;
+    UINT    hash_size;
 };
 
 struct tagMSITABLE
@@ -1155,6 +1156,49 @@ static UINT TABLE_fetch_stream( struct tagMSIVIEW *view, UINT row, UINT col, ISt
     return r;
 }
 
+static inline struct column_hash_entry *get_column_hash_entries( const struct column_info *colinfo )
+{
+    return (struct column_hash_entry *)(colinfo->hash_table + colinfo->hash_size);
+}
+
+/* keep the chains ordered by row so that lookups return rows in table order */
+static void add_column_hash_entry( struct column_info *colinfo, struct column_hash_entry *entry )
+{
+    struct column_hash_entry **prev = &colinfo->hash_table[entry->value % colinfo->hash_size];
+
+    while (*prev && (*prev)->row < entry->row)
+        prev = &(*prev)->next;
+    entry->next = *prev;
+    *prev = entry;
+}
+
+static void update_column_hash( struct column_info *colinfo, UINT row, UINT val )
+{
+    struct column_hash_entry *entry = &get_column_hash_entries( colinfo )[row], **prev;
+
+    if (entry->value == val)
+        return;
+
+    prev = &colinfo->hash_table[entry->value % colinfo->hash_size];
+    while (*prev != entry)
+        prev = &(*prev)->next;
+    *prev = entry->next;
+
+    entry->value = val;
+    add_column_hash_entry( colinfo, entry );
+}
+
+static void free_column_hashes( struct table_view *tv )
+{
+    UINT i;
+
+    for (i = 0; i < tv->num_cols; i++)
+    {
+        free( tv->columns[i].hash_table );
+        tv->columns[i].hash_table = NULL;
+    }
+}
+
 /* Set a table value, i.e. preadjusted integer or string ID. */
 static UINT table_set_bytes( struct table_view *tv, UINT row, UINT col, UINT val )
 {
@@ -1176,9 +1220,6 @@ static UINT table_set_bytes( struct table_view *tv, UINT row, UINT col, UINT val
         return ERROR_FUNCTION_FAILED;
     }
 
-    free( tv->columns[col-1].hash_table );
-    tv->columns[col-1].hash_table = NULL;
-
     n = bytes_per_column( tv->db, &tv->columns[col - 1], LONG_STR_BYTES );
     if ( n != 2 && n != 3 && n != 4 )
     {
@@ -1186,6 +1227,9 @@ static UINT table_set_bytes( struct table_view *tv, UINT row, UINT col, UINT val
         return ERROR_FUNCTION_FAILED;
     }
 
+    if (tv->columns[col-1].hash_table)
+        update_column_hash( &tv->columns[col-1], row, n < 4 ? val & ((1 << n * 8) - 1) : val );
+
     offset = tv->columns[col-1].offset;
     for ( i = 0; i < n; i++ )
         tv->table->data[row][offset + i] = (val >> i * 8) & 0xff;
@@ -1520,6 +1564,9 @@ static UINT table_create_new_row( struct tagMSIVIEW *view, UINT *num, BOOL tempo
         return ERROR_NOT_ENOUGH_MEMORY;
     }
 
+    /* the following rows are shifted, forget about their positions */
+    free_column_hashes( tv );
+
     *data_ptr = p;
     (*data_ptr)[*row_count] = row;
 
@@ -1776,11 +1823,7 @@ static UINT TABLE_delete_row( struct tagMSIVIEW *view, UINT row )
     tv->table->row_count--;
 
     /* reset the hash tables */
-    for (i = 0; i < tv->num_cols; i++)
-    {
-        free(tv->columns[i].hash_table);
-        tv->columns[i].hash_table = NULL;
-    }
+    free_column_hashes( tv );
 
     for (i = row + 1; i < num_rows; i++)
     {
@@ -1964,6 +2007,7 @@ static UINT TABLE_remove_column(struct tagMSIVIEW *view, UINT number)
     if (tv->table->colinfo[number-1].type & MSITYPE_TEMPORARY)
     {
         UINT size = tv->table->colinfo[number-1].offset;
+        free(tv->table->colinfo[number-1].hash_table);
         tv->table->col_count--;
         tv->table->colinfo = realloc(tv->table->colinfo, sizeof(*tv->table->colinfo) * tv->table->col_count);
 
@@ -2182,6 +2226,68 @@ done:
     return r;
 }
 
+static UINT TABLE_find_matching_rows( struct tagMSIVIEW *view, UINT col,
+    UINT val, UINT *row, MSIITERHANDLE *handle )
+{
+    struct table_view *tv = (struct table_view *)view;
+    const struct column_hash_entry *entry;
+    struct column_info *colinfo;
+
+    TRACE("%p, %u, %u, %p\n", view, col, val, *handle);
+
+    if( !tv->table )
+        return ERROR_INVALID_PARAMETER;
+
+    if( (col==0) || (col > tv->num_cols) )
+        return ERROR_INVALID_PARAMETER;
+
+    colinfo = &tv->columns[col-1];
+    if( !colinfo->hash_table )
+    {
+        UINT i, num_rows = tv->table->row_count, size = max( MSITABLE_HASH_TABLE_SIZE, num_rows | 1 );
+        struct column_hash_entry **hash_table, *entries;
+
+        /* allocate contiguous memory for the table and its entries, which are
+         * indexed by row so that they can be updated in place by set_int */
+        hash_table = calloc( 1, size * sizeof(*hash_table) + num_rows * sizeof(*entries) );
+        if (!hash_table)
+            return ERROR_OUTOFMEMORY;
+
+        entries = (struct column_hash_entry *)(hash_table + size);
+        for (i = num_rows; i > 0; i--)
+        {
+            UINT r = TABLE_fetch_int( view, i - 1, col, &entries[i - 1].value );
+            if (r != ERROR_SUCCESS)
+            {
+                free( hash_table );
+                return r;
+            }
+            entries[i - 1].row = i - 1;
+            entries[i - 1].next = hash_table[entries[i - 1].value % size];
+            hash_table[entries[i - 1].value % size] = &entries[i - 1];
+        }
+
+        colinfo->hash_table = hash_table;
+        colinfo->hash_size = size;
+    }
+
+    if( !*handle )
+        entry = colinfo->hash_table[val % colinfo->hash_size];
+    else
+        entry = (*handle)->next;
+
+    while (entry && entry->value != val)
+        entry = entry->next;
+
+    *handle = entry;
+    if (!entry)
+        return ERROR_NO_MORE_ITEMS;
+
+    *row = entry->row;
+
+    return ERROR_SUCCESS;
+}
+
 static const MSIVIEWOPS table_ops =
 {
     TABLE_fetch_int,
@@ -2198,6 +2304,7 @@ static const MSIVIEWOPS table_ops =
     TABLE_get_column_info,
     TABLE_modify,
     TABLE_delete,
+    TABLE_find_matching_rows,
     TABLE_add_ref,
     TABLE_release,
     TABLE_add_column,
@@ -2779,6 +2886,7 @@ static const MSIVIEWOPS transform_view_ops =
     NULL,
     NULL,
     NULL,
+    NULL,
     NULL
 };
 
@@ -3165,11 +3273,36 @@ static UINT row_matches( struct table_view *tv, UINT row, const UINT *data, UINT
 
 static UINT table_find_row( struct table_view *tv, MSIRECORD *rec, UINT *row, UINT *column )
 {
-    UINT i, r = ERROR_FUNCTION_FAILED, *data;
+    UINT i, key, r = ERROR_FUNCTION_FAILED, *data;
+    MSIITERHANDLE handle = NULL;
 
     data = record_to_row( tv, rec );
     if( !data )
         return r;
+
+    /* if the first key column is indexed only rows matching it need to be
+     * compared, don't build an index here as inserting a row drops it */
+    for( key = 0; key < tv->num_cols; key++ )
+        if ( tv->columns[key].type & MSITYPE_KEY ) break;
+
+    if ( key < tv->num_cols && tv->columns[key].hash_table )
+    {
+        TABLE_find_matching_rows( &tv->view, key + 1, data[key], &i, &handle );
+        while ( handle )
+        {
+            r = row_matches( tv, i, data, column );
+            if( r == ERROR_SUCCESS )
+            {
+                *row = i;
+                break;
+            }
+            if ( TABLE_find_matching_rows( &tv->view, key + 1, data[key], &i, &handle ) != ERROR_SUCCESS )
+                r = ERROR_FUNCTION_FAILED;
+        }
+        free( data );
+        return r;
+    }
+
     for( i = 0; i < tv->table->row_count; i++ )
     {
         r = row_matches( tv, i, data, column );
@@ -51,6 +51,8 @@ struct join_table
     UINT col_count;
     UINT row_count;
     UINT table_index;
+    const struct expr *key_column; /* column of this table compared for equality */
+    const struct expr *key_value;  /* to a constant or a column of an outer table */
 };
 
 typedef struct tagMSIORDERINFO
@@ -647,15 +649,85 @@ static UINT WHERE_evaluate( MSIWHEREVIEW *wv, const UINT rows[],
     return ERROR_SUCCESS;
 }
 
+/* Computes the value the key column of a table has to match for the current
+ * rows of the outer tables. Returns ERROR_NO_MORE_ITEMS if no row can match
+ * and ERROR_FUNCTION_FAILED if the table has to be scanned. */
+static UINT get_table_key( MSIWHEREVIEW *wv, const UINT rows[], const struct join_table *table, UINT *key )
+{
+    const struct expr *value = table->key_value;
+    const WCHAR *str;
+    UINT r, val;
+
+    if (!table->key_column || !table->view->ops->find_matching_rows)
+        return ERROR_FUNCTION_FAILED;
+
+    switch (value->type)
+    {
+    case EXPR_SVAL:
+        /* empty strings also match null values */
+        if (!*value->u.sval)
+            return ERROR_FUNCTION_FAILED;
+        if (msi_string2id( wv->db->strings, value->u.sval, -1, key ) != ERROR_SUCCESS)
+            return ERROR_NO_MORE_ITEMS;
+        return ERROR_SUCCESS;
+
+    case EXPR_COL_NUMBER_STRING:
+        r = expr_fetch_value( &value->u.column, rows, key );
+        if (r != ERROR_SUCCESS)
+            return ERROR_FUNCTION_FAILED;
+        str = msi_string_lookup( wv->db->strings, *key, NULL );
+        if (!str || !*str)
+            return ERROR_FUNCTION_FAILED;
+        return ERROR_SUCCESS;
+
+    case EXPR_UVAL:
+        val = value->u.uval;
+        break;
+
+    case EXPR_COL_NUMBER:
+    case EXPR_COL_NUMBER32:
+        r = expr_fetch_value( &value->u.column, rows, &val );
+        if (r != ERROR_SUCCESS)
+            return ERROR_FUNCTION_FAILED;
+        val -= value->type == EXPR_COL_NUMBER ? 0x8000 : 0x80000000;
+        break;
+
+    default:
+        return ERROR_FUNCTION_FAILED;
+    }
+
+    /* turn the value into the form stored in the table */
+    *key = val + (table->key_column->type == EXPR_COL_NUMBER ? 0x8000 : 0x80000000);
+    return ERROR_SUCCESS;
+}
+
 static UINT check_condition( MSIWHEREVIEW *wv, MSIRECORD *record, struct join_table **tables,
                              UINT table_rows[] )
 {
-    UINT r = ERROR_FUNCTION_FAILED;
+    struct join_table *table = *tables;
+    MSIITERHANDLE handle = NULL;
+    UINT r, key, row = 0;
+    BOOL indexed = FALSE;
     INT val;
 
-    for (table_rows[(*tables)->table_index] = 0;
-         table_rows[(*tables)->table_index] < (*tables)->row_count;
-         table_rows[(*tables)->table_index]++)
+    r = get_table_key( wv, table_rows, table, &key );
+    if (r == ERROR_SUCCESS)
+    {
+        r = table->view->ops->find_matching_rows( table->view, table->key_column->u.column.parsed.column,
+                                                  key, &row, &handle );
+        /* rows not matching the key can't satisfy the condition */
+        if (r == ERROR_NO_MORE_ITEMS)
+            return ERROR_SUCCESS;
+        indexed = (r == ERROR_SUCCESS);
+        if (!indexed) row = 0;
+    }
+    else if (r == ERROR_NO_MORE_ITEMS)
+        return ERROR_SUCCESS;
+
+    r = ERROR_FUNCTION_FAILED;
+    for (table_rows[table->table_index] = row;
+         table_rows[table->table_index] < table->row_count;
+         table_rows[table->table_index] = indexed ? row : table_rows[table->table_index] + 1)
     {
         val = 0;
         wv->rec_index = 0;
@@ -677,8 +749,12 @@ static UINT check_condition( MSIWHEREVIEW *wv, MSIRECORD *record, struct join_ta
                 add_row (wv, table_rows);
             }
         }
+
+        if (indexed && table->view->ops->find_matching_rows( table->view,
+                table->key_column->u.column.parsed.column, key, &row, &handle ) != ERROR_SUCCESS)
+            break;
     }
-    table_rows[(*tables)->table_index] = INVALID_ROW_INDEX;
+    table_rows[table->table_index] = INVALID_ROW_INDEX;
     return r;
 }
 
@@ -786,6 +862,67 @@ static UINT reorder_check( const struct expr *expr, struct join_table **ordered_
     }
 }
 
+static BOOL is_outer_column( const struct expr *expr, struct join_table **tables,
+                             const struct join_table *table, int type )
+{
+    if (expr->type != type && !(type == EXPR_COL_NUMBER && expr->type == EXPR_COL_NUMBER32))
+        return FALSE;
+
+    for (; *tables != table; tables++)
+        if (*tables == expr->u.column.parsed.table) return TRUE;
+    return FALSE;
+}
+
+static BOOL is_key_expr( const struct expr *column, const struct expr *value, struct join_table **tables,
+                         const struct join_table *table, BOOL string )
+{
+    if (string)
+    {
+        if (column->type != EXPR_COL_NUMBER_STRING || column->u.column.parsed.table != table)
+            return FALSE;
+        return value->type == EXPR_SVAL || is_outer_column( value, tables, table, EXPR_COL_NUMBER_STRING );
+    }
+
+    if ((column->type != EXPR_COL_NUMBER && column->type != EXPR_COL_NUMBER32) ||
+        column->u.column.parsed.table != table)
+        return FALSE;
+    return value->type == EXPR_UVAL || is_outer_column( value, tables, table, EXPR_COL_NUMBER );
+}
+
+/* looks for an equality in the top level conjunctions of the condition that
+ * can be used to look up the rows of a table through an index */
+static void find_table_key( const struct expr *expr, struct join_table **tables, struct join_table *table )
+{
+    const struct expr *left, *right;
+
+    if (table->key_column || (expr->type != EXPR_COMPLEX && expr->type != EXPR_STRCMP))
+        return;
+
+    left = expr->u.expr.left;
+    right = expr->u.expr.right;
+
+    if (expr->type == EXPR_COMPLEX && expr->u.expr.op == OP_AND)
+    {
+        find_table_key( left, tables, table );
+        find_table_key( right, tables, table );
+        return;
+    }
+
+    if (expr->u.expr.op != OP_EQ)
+        return;
+
+    if (is_key_expr( left, right, tables, table, expr->type == EXPR_STRCMP ))
+    {
+        table->key_column = left;
+        table->key_value = right;
+    }
+    else if (is_key_expr( right, left, tables, table, expr->type == EXPR_STRCMP ))
+    {
+        table->key_column = right;
+        table->key_value = left;
+    }
+}
+
 /* reorders the tablelist in a way to evaluate the condition as fast as possible */
 static struct join_table **ordertables( MSIWHEREVIEW *wv )
 {
@@ -847,6 +984,13 @@ static UINT WHERE_execute( struct tagMSIVIEW *view, MSIRECORD *record )
 
     ordered_tables = ordertables( wv );
 
+    for (i = 0; i < wv->table_count; i++)
+    {
+        ordered_tables[i]->key_column = ordered_tables[i]->key_value = NULL;
+        if (wv->cond)
+            find_table_key( wv->cond, ordered_tables, ordered_tables[i] );
+    }
+
     rows = malloc(wv->table_count * sizeof(*rows));
     for (i = 0; i < wv->table_count; i++)
         rows[i] = INVALID_ROW_INDEX;
@@ -1130,6 +1274,7 @@ static const MSIVIEWOPS where_ops =
     NULL,
     NULL,
     NULL,
+    NULL,
     WHERE_sort,
     NULL,
 };
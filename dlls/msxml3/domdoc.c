@@ -226,6 +226,11 @@ BOOL is_xpathmode(const xmlDocPtr doc)
     return properties_from_xmlDocPtr(doc)->XPath;
 }
 
+const xmlChar *get_selection_namespaces(xmlDocPtr doc)
+{
+    return properties_from_xmlDocPtr(doc)->selectNsStr;
+}
+
 void set_xpathmode(xmlDocPtr doc, BOOL xpath)
 {
     properties_from_xmlDocPtr(doc)->XPath = xpath;
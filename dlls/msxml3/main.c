@@ -386,6 +386,7 @@ BOOL WINAPI DllMain(HINSTANCE hInstDLL, DWORD fdwReason, LPVOID reserved)
         xmlCleanupInputCallbacks();
         xmlRegisterDefaultInputCallbacks();
 
+        release_selection_cache();
         xmlCleanupParser();
         schemasCleanup();
         release_typelib();
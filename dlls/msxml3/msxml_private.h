@@ -139,6 +139,7 @@ extern IUnknown         *create_doc_fragment( xmlNodePtr );
 extern IUnknown         *create_doc_entity_ref( xmlNodePtr );
 extern IUnknown         *create_doc_type( xmlNodePtr );
 extern HRESULT           create_selection( xmlNodePtr, xmlChar*, IXMLDOMNodeList** );
+extern void              release_selection_cache( void );
 extern HRESULT           create_enumvariant( IUnknown*, BOOL, const struct enumvariant_funcs*, IEnumVARIANT**);
 extern HRESULT           create_dom_implementation(IXMLDOMImplementation **obj);
 
@@ -183,6 +184,7 @@ extern void wineXmlCallbackError(char const* caller, const xmlError* err);
 extern BOOL is_preserving_whitespace(xmlNodePtr node);
 extern BOOL is_xpathmode(const xmlDocPtr doc);
 extern void set_xpathmode(xmlDocPtr doc, BOOL xpath);
+extern const xmlChar *get_selection_namespaces(xmlDocPtr doc);
 
 extern void init_xmlnode(xmlnode*,xmlNodePtr,IXMLDOMNode*,dispex_static_data_t*);
 extern void destroy_xmlnode(xmlnode*);
@@ -380,16 +380,19 @@ static HRESULT write_output_buffer(mxwriter *writer, const WCHAR *data, int len)
         else
         {
             unsigned int avail = buff->allocated - buff->written;
-            int length;
+            int length = 0;
 
-            length = WideCharToMultiByte(buffer->code_page, 0, data, src_len, NULL, 0, NULL, NULL);
-            if (avail >= length)
-            {
-                length = WideCharToMultiByte(buffer->code_page, 0, data, src_len, buff->data + buff->written, length, NULL, NULL);
+            /* Every character takes at least a byte, so there's no point in trying unless the
+               chunk could fit. Most do, and are converted in a single pass this way. */
+            if (avail >= src_len)
+                length = WideCharToMultiByte(buffer->code_page, 0, data, src_len, buff->data + buff->written, avail, NULL, NULL);
+
+            if (length)
                 buff->written += length;
-            }
             else
             {
+                length = WideCharToMultiByte(buffer->code_page, 0, data, src_len, NULL, 0, NULL, NULL);
+
                 /* drain what we go so far */
                 if (buff->written)
                 {
@@ -570,6 +573,25 @@ static WCHAR *get_escaped_string(const WCHAR *str, escape_mode mode, int *len)
     return ret;
 }
 
+static BOOL is_escaping_needed(const WCHAR *str, int len, escape_mode mode)
+{
+    while (len--)
+    {
+        switch (*str++)
+        {
+        case '<':
+        case '&':
+        case '>':
+            return TRUE;
+        case '"':
+            if (mode == EscapeValue) return TRUE;
+            break;
+        }
+    }
+
+    return FALSE;
+}
+
 static void write_prolog_buffer(mxwriter *writer)
 {
     static const WCHAR versionW[] = {'<','?','x','m','l',' ','v','e','r','s','i','o','n','='};
@@ -1277,7 +1299,7 @@ static void mxwriter_write_attribute(mxwriter *writer, const WCHAR *qname, int q
     write_output_buffer(writer, qname, qname_len);
     write_output_buffer(writer, eqW, 1);
 
-    if (escape)
+    if (escape && is_escaping_needed(value, value_len, EscapeValue))
     {
         WCHAR *escaped = get_escaped_string(value, EscapeValue, &value_len);
         write_output_buffer_quoted(writer, escaped, value_len);
@@ -1411,7 +1433,8 @@ static HRESULT WINAPI SAXContentHandler_characters(
 
     if (nchars)
     {
-        if (This->cdata || This->props[MXWriter_DisableEscaping] == VARIANT_TRUE)
+        if (This->cdata || This->props[MXWriter_DisableEscaping] == VARIANT_TRUE ||
+                !is_escaping_needed(chars, nchars, EscapeText))
             write_output_buffer(This, chars, nchars);
         else
         {
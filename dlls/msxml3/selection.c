@@ -761,16 +761,125 @@ static void query_serror(void* ctx, const xmlError* err)
     LIBXML2_CALLBACK_SERROR(domselection_create, err);
 }
 
-HRESULT create_selection(xmlNodePtr node, xmlChar* query, IXMLDOMNodeList **out)
+/* Compiled queries are kept around in a process wide MRU list, documents are
+   commonly queried with the same expressions over and over. Translation of
+   XSLPattern queries depends on selection namespaces, so those are part of the key. */
+struct compiled_query
+{
+    struct list entry;
+    LONG ref;
+    BOOL xpath;
+    xmlChar *query;
+    xmlChar *ns;
+    xmlXPathCompExprPtr comp;
+};
+
+#define SELECTION_CACHE_SIZE 256
+
+static struct list selection_cache = LIST_INIT(selection_cache);
+static unsigned int selection_cache_count;
+
+static CRITICAL_SECTION selection_cache_cs;
+static CRITICAL_SECTION_DEBUG selection_cache_cs_dbg =
+{
+    0, 0, &selection_cache_cs,
+    { &selection_cache_cs_dbg.ProcessLocksList, &selection_cache_cs_dbg.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": selection_cache") }
+};
+static CRITICAL_SECTION selection_cache_cs = { &selection_cache_cs_dbg, -1, 0, 0, 0, 0 };
+
+static void compiled_query_release(struct compiled_query *query)
+{
+    if (InterlockedDecrement(&query->ref)) return;
+
+    xmlXPathFreeCompExpr(query->comp);
+    xmlFree(query->query);
+    xmlFree(query->ns);
+    free(query);
+}
+
+static struct compiled_query *compile_query(xmlXPathContextPtr ctxt, const xmlChar *str, BOOL xpath)
+{
+    const xmlChar *ns = get_selection_namespaces(ctxt->doc);
+    struct compiled_query *query;
+    xmlXPathCompExprPtr comp;
+    xmlChar *pattern_query;
+
+    EnterCriticalSection(&selection_cache_cs);
+    LIST_FOR_EACH_ENTRY(query, &selection_cache, struct compiled_query, entry)
+    {
+        if (query->xpath == xpath && xmlStrEqual(query->query, str) && xmlStrEqual(query->ns, ns))
+        {
+            list_remove(&query->entry);
+            list_add_head(&selection_cache, &query->entry);
+            InterlockedIncrement(&query->ref);
+            LeaveCriticalSection(&selection_cache_cs);
+            return query;
+        }
+    }
+    LeaveCriticalSection(&selection_cache_cs);
+
+    if (xpath)
+        comp = xmlXPathCtxtCompile(ctxt, str);
+    else
+    {
+        pattern_query = XSLPattern_to_XPath(ctxt, str);
+        comp = xmlXPathCtxtCompile(ctxt, pattern_query);
+        xmlFree(pattern_query);
+    }
+
+    if (!comp) return NULL;
+
+    if (!(query = malloc(sizeof(*query))))
+    {
+        xmlXPathFreeCompExpr(comp);
+        return NULL;
+    }
+
+    query->ref = 2;
+    query->xpath = xpath;
+    query->query = xmlStrdup(str);
+    query->ns = xmlStrdup(ns);
+    query->comp = comp;
+
+    EnterCriticalSection(&selection_cache_cs);
+    list_add_head(&selection_cache, &query->entry);
+    if (++selection_cache_count > SELECTION_CACHE_SIZE)
+    {
+        struct compiled_query *last = LIST_ENTRY(list_tail(&selection_cache), struct compiled_query, entry);
+
+        list_remove(&last->entry);
+        selection_cache_count--;
+        compiled_query_release(last);
+    }
+    LeaveCriticalSection(&selection_cache_cs);
+
+    return query;
+}
+
+void release_selection_cache(void)
+{
+    struct compiled_query *query, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE(query, next, &selection_cache, struct compiled_query, entry)
+    {
+        list_remove(&query->entry);
+        compiled_query_release(query);
+    }
+    selection_cache_count = 0;
+}
+
+HRESULT create_selection(xmlNodePtr node, xmlChar* query_str, IXMLDOMNodeList **out)
 {
     domselection *This = malloc(sizeof(domselection));
     xmlXPathContextPtr ctxt = xmlXPathNewContext(node->doc);
+    struct compiled_query *query = NULL;
     HRESULT hr;
 
-    TRACE("(%p, %s, %p)\n", node, debugstr_a((char const*)query), out);
+    TRACE("(%p, %s, %p)\n", node, debugstr_a((char const*)query_str), out);
 
     *out = NULL;
-    if (!This || !ctxt || !query)
+    if (!This || !ctxt || !query_str)
     {
         xmlXPathFreeContext(ctxt);
         free(This);
@@ -779,6 +888,7 @@ HRESULT create_selection(xmlNodePtr node, xmlChar* query, IXMLDOMNodeList **out)
 
     This->IXMLDOMSelection_iface.lpVtbl = &domselection_vtbl;
     This->ref = 1;
+    This->result = NULL;
     This->resultPos = 0;
     This->node = node;
     This->enumvariant = NULL;
@@ -793,12 +903,10 @@ HRESULT create_selection(xmlNodePtr node, xmlChar* query, IXMLDOMNodeList **out)
     if (is_xpathmode(This->node->doc))
     {
         xmlXPathRegisterAllFunctions(ctxt);
-        This->result = xmlXPathEvalExpression(query, ctxt);
+        query = compile_query(ctxt, query_str, TRUE);
     }
     else
     {
-        xmlChar* pattern_query = XSLPattern_to_XPath(ctxt, query);
-
         xmlXPathRegisterFunc(ctxt, (xmlChar const*)"not", xmlXPathNotFunction);
         xmlXPathRegisterFunc(ctxt, (xmlChar const*)"boolean", xmlXPathBooleanFunction);
 
@@ -813,8 +921,13 @@ HRESULT create_selection(xmlNodePtr node, xmlChar* query, IXMLDOMNodeList **out)
         xmlXPathRegisterFunc(ctxt, (xmlChar const*)"OP_IGt", XSLPattern_OP_IGt);
         xmlXPathRegisterFunc(ctxt, (xmlChar const*)"OP_IGEq", XSLPattern_OP_IGEq);
 
-        This->result = xmlXPathEvalExpression(pattern_query, ctxt);
-        xmlFree(pattern_query);
+        query = compile_query(ctxt, query_str, FALSE);
+    }
+
+    if (query)
+    {
+        This->result = xmlXPathCompiledEval(query->comp, ctxt);
+        compiled_query_release(query);
     }
 
     if (!This->result || This->result->type != XPATH_NODESET)
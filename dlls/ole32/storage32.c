@@ -7143,14 +7143,14 @@ static HRESULT BlockChainStream_UpdateIndexCache(BlockChainStream* This)
   return S_OK;
 }
 
-/* Locate the nth block in this stream. */
-static ULONG BlockChainStream_GetSectorOfOffset(BlockChainStream *This, ULONG offset)
+/* Locate the run of consecutive sectors holding the nth block in this stream. */
+static struct BlockChainRun *BlockChainStream_GetRunOfOffset(BlockChainStream *This, ULONG offset)
 {
   ULONG min_offset = 0, max_offset = This->numBlocks-1;
   ULONG min_run = 0, max_run = This->indexCacheLen-1;
 
   if (offset >= This->numBlocks)
-    return BLOCK_END_OF_CHAIN;
+    return NULL;
 
   while (min_run < max_run)
   {
@@ -7170,7 +7170,39 @@ static ULONG BlockChainStream_GetSectorOfOffset(BlockChainStream *This, ULONG of
       min_run = max_run = run_to_check;
   }
 
-  return This->indexCache[min_run].firstSector + offset - This->indexCache[min_run].firstOffset;
+  return &This->indexCache[min_run];
+}
+
+/* Locate the nth block in this stream. */
+static ULONG BlockChainStream_GetSectorOfOffset(BlockChainStream *This, ULONG offset)
+{
+  struct BlockChainRun *run = BlockChainStream_GetRunOfOffset(This, offset);
+
+  if (!run)
+    return BLOCK_END_OF_CHAIN;
+
+  return run->firstSector + offset - run->firstOffset;
+}
+
+/* Returns how many of the blocks following the nth block can be accessed
+ * together with it, that is reside in the following sectors and are not held
+ * by the block cache. At most max_count blocks are returned. */
+static ULONG BlockChainStream_GetContiguousBlocks(BlockChainStream *This, ULONG offset, ULONG max_count)
+{
+  struct BlockChainRun *run = BlockChainStream_GetRunOfOffset(This, offset);
+  ULONG count;
+  int i;
+
+  if (!run)
+    return 0;
+
+  count = min(run->lastOffset - offset, max_count);
+
+  for (i=0; i<2; i++)
+    if (This->cachedBlocks[i].index > offset && This->cachedBlocks[i].index <= offset + count)
+      count = This->cachedBlocks[i].index - offset - 1;
+
+  return count;
 }
 
 static HRESULT BlockChainStream_GetBlockAtOffset(BlockChainStream *This,
@@ -7617,7 +7649,15 @@ HRESULT BlockChainStream_ReadAt(BlockChainStream* This,
 
     if (!cachedBlock)
     {
-      /* Not in cache, and we're going to read past the end of the block. */
+      /* Not in cache, and we're going to read past the end of the block.
+       * Read the whole blocks that follow in the file at once, leaving the
+       * last one to the cache. */
+      ULONG count = BlockChainStream_GetContiguousBlocks(This, blockNoInSequence,
+          (size - bytesToReadInBuffer - 1) / This->parentStorage->bigBlockSize);
+
+      bytesToReadInBuffer += count * This->parentStorage->bigBlockSize;
+      blockNoInSequence += count;
+
       ulOffset.QuadPart = StorageImpl_GetBigBlockOffset(This->parentStorage, blockIndex) +
                                offsetInBlock;
 
@@ -7701,7 +7741,15 @@ HRESULT BlockChainStream_WriteAt(BlockChainStream* This,
 
     if (!cachedBlock)
     {
-      /* Not in cache, and we're going to write past the end of the block. */
+      /* Not in cache, and we're going to write past the end of the block.
+       * Write the whole blocks that follow in the file at once, leaving the
+       * last one to the cache. */
+      ULONG count = BlockChainStream_GetContiguousBlocks(This, blockNoInSequence,
+          (size - bytesToWrite - 1) / This->parentStorage->bigBlockSize);
+
+      bytesToWrite += count * This->parentStorage->bigBlockSize;
+      blockNoInSequence += count;
+
       ulOffset.QuadPart = StorageImpl_GetBigBlockOffset(This->parentStorage, blockIndex) +
                                offsetInBlock;
 
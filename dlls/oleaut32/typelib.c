@@ -1231,6 +1231,7 @@ typedef struct tagITypeInfoImpl
 
     /* functions  */
     TLBFuncDesc *funcdescs;
+    struct func_name_index *func_names; /* lazily built, see typeinfo_find_func_by_name */
 
     /* variables  */
     TLBVarDesc *vardescs;
@@ -1277,6 +1278,10 @@ typedef struct tagTLBContext
 	void *mapping;        /* memory mapping */
 	MSFT_SegDir * pTblDir;
 	ITypeLibImpl* pLibInfo;
+	/* lookup tables indexed by table offset, only valid while loading */
+	TLBString **names;
+	TLBString **strings;
+	TLBGuid **guids;
 } TLBContext;
 
 
@@ -1705,6 +1710,108 @@ static inline TLBVarDesc *TLB_get_vardesc_by_name(ITypeInfoImpl *typeinfo, const
     return NULL;
 }
 
+/* Case insensitive hash of the function names of a typeinfo, used by
+ * GetIDsOfNames on interfaces with many methods. Only built when every
+ * name is a plain ASCII identifier, so that ASCII case folding agrees
+ * with lstrcmpiW. Entries hold the funcdesc index + 1, 0 means empty. */
+struct func_name_index
+{
+    UINT mask;
+    UINT entries[];
+};
+
+#define FUNC_NAME_INDEX_MIN_FUNCS 16
+
+static const struct func_name_index no_func_name_index;
+
+static BOOL func_name_hash(const WCHAR *name, UINT *hash)
+{
+    UINT h = 0;
+
+    if (!name || !*name) return FALSE;
+    for (; *name; name++)
+    {
+        WCHAR c = *name;
+        if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+        else if (!(c >= 'a' && c <= 'z') && !(c >= '0' && c <= '9') && c != '_') return FALSE;
+        h = h * 31 + c;
+    }
+    *hash = h;
+    return TRUE;
+}
+
+static struct func_name_index *typeinfo_build_func_name_index(ITypeInfoImpl *typeinfo)
+{
+    struct func_name_index *index;
+    UINT i, size = 32, hash;
+
+    while (size < typeinfo->typeattr.cFuncs * 2) size <<= 1;
+    if (!(index = calloc(1, offsetof(struct func_name_index, entries[size]))))
+        return NULL;
+    index->mask = size - 1;
+
+    for (i = 0; i < typeinfo->typeattr.cFuncs; ++i)
+    {
+        const WCHAR *name = TLB_get_bstr(typeinfo->funcdescs[i].Name);
+        UINT pos;
+
+        if (!func_name_hash(name, &hash))
+        {
+            free(index);
+            return (struct func_name_index *)&no_func_name_index;
+        }
+        for (pos = hash & index->mask; index->entries[pos]; pos = (pos + 1) & index->mask)
+            if (!lstrcmpiW(TLB_get_bstr(typeinfo->funcdescs[index->entries[pos] - 1].Name), name)) break;
+        /* keep the first function of a given name, as a linear search would */
+        if (!index->entries[pos]) index->entries[pos] = i + 1;
+    }
+    return index;
+}
+
+static void typeinfo_free_func_name_index(ITypeInfoImpl *typeinfo)
+{
+    if (typeinfo->func_names != &no_func_name_index) free(typeinfo->func_names);
+    typeinfo->func_names = NULL;
+}
+
+static const TLBFuncDesc *typeinfo_find_func_by_name(ITypeInfoImpl *typeinfo, const OLECHAR *name)
+{
+    struct func_name_index *index;
+    UINT i, hash;
+
+    if (typeinfo->typeattr.cFuncs >= FUNC_NAME_INDEX_MIN_FUNCS)
+    {
+        if (!(index = typeinfo->func_names) &&
+                (index = typeinfo_build_func_name_index(typeinfo)))
+        {
+            struct func_name_index *prev;
+
+            if ((prev = InterlockedCompareExchangePointer((void **)&typeinfo->func_names, index, NULL)))
+            {
+                if (index != &no_func_name_index) free(index);
+                index = prev;
+            }
+        }
+
+        if (index && index != &no_func_name_index && func_name_hash(name, &hash))
+        {
+            for (i = hash & index->mask; index->entries[i]; i = (i + 1) & index->mask)
+            {
+                const TLBFuncDesc *func = &typeinfo->funcdescs[index->entries[i] - 1];
+                if (!lstrcmpiW(name, TLB_get_bstr(func->Name))) return func;
+            }
+            return NULL;
+        }
+    }
+
+    for (i = 0; i < typeinfo->typeattr.cFuncs; ++i)
+    {
+        if (!lstrcmpiW(name, TLB_get_bstr(typeinfo->funcdescs[i].Name)))
+            return &typeinfo->funcdescs[i];
+    }
+    return NULL;
+}
+
 static inline TLBCustData *TLB_get_custdata_by_guid(const struct list *custdata_list, REFGUID guid)
 {
     TLBCustData *cust_data;
@@ -2074,6 +2181,9 @@ static HRESULT MSFT_ReadAllGuids(TLBContext *pcx)
     MSFT_GuidEntry entry;
     int offs = 0;
 
+    if (pcx->pTblDir->pGuidTab.length > 0)
+        pcx->guids = calloc(pcx->pTblDir->pGuidTab.length / sizeof(MSFT_GuidEntry) + 1, sizeof(*pcx->guids));
+
     MSFT_Seek(pcx, pcx->pTblDir->pGuidTab.offset);
     while (1) {
         if (offs >= pcx->pTblDir->pGuidTab.length)
@@ -2088,6 +2198,7 @@ static HRESULT MSFT_ReadAllGuids(TLBContext *pcx)
         guid->hreftype = entry.hreftype;
 
         list_add_tail(&pcx->pLibInfo->guid_list, &guid->entry);
+        if (pcx->guids) pcx->guids[offs / sizeof(MSFT_GuidEntry)] = guid;
 
         offs += sizeof(MSFT_GuidEntry);
     }
@@ -2097,14 +2208,12 @@ static TLBGuid *MSFT_ReadGuid( int offset, TLBContext *pcx)
 {
     TLBGuid *ret;
 
-    LIST_FOR_EACH_ENTRY(ret, &pcx->pLibInfo->guid_list, TLBGuid, entry){
-        if(ret->offset == offset){
-            TRACE_(typelib)("%s\n", debugstr_guid(&ret->guid));
-            return ret;
-        }
-    }
+    if (offset < 0 || offset >= pcx->pTblDir->pGuidTab.length || offset % sizeof(MSFT_GuidEntry) || !pcx->guids)
+        return NULL;
 
-    return NULL;
+    if ((ret = pcx->guids[offset / sizeof(MSFT_GuidEntry)]))
+        TRACE_(typelib)("%s\n", debugstr_guid(&ret->guid));
+    return ret;
 }
 
 static HREFTYPE MSFT_ReadHreftype( TLBContext *pcx, int offset )
@@ -2130,6 +2239,9 @@ static HRESULT MSFT_ReadAllNames(TLBContext *pcx)
     INT16 len_piece;
     int offs = 0, lengthInChars;
 
+    if (pcx->pTblDir->pNametab.length > 0)
+        pcx->names = calloc(pcx->pTblDir->pNametab.length / 4 + 1, sizeof(*pcx->names));
+
     MSFT_Seek(pcx, pcx->pTblDir->pNametab.offset);
     while (1) {
         TLBString *tlbstr;
@@ -2165,37 +2277,33 @@ static HRESULT MSFT_ReadAllNames(TLBContext *pcx)
         free(string);
 
         list_add_tail(&pcx->pLibInfo->name_list, &tlbstr->entry);
+        if (pcx->names) pcx->names[offs / 4] = tlbstr;
 
         offs += len_piece;
     }
 }
 
-static TLBString *MSFT_ReadName( TLBContext *pcx, int offset)
+/* name and string table entries are padded to multiples of 4 bytes */
+static TLBString *MSFT_LookupString( TLBString **table, const MSFT_pSeg *seg, int offset)
 {
     TLBString *tlbstr;
 
-    LIST_FOR_EACH_ENTRY(tlbstr, &pcx->pLibInfo->name_list, TLBString, entry) {
-        if (tlbstr->offset == offset) {
-            TRACE_(typelib)("%s\n", debugstr_w(tlbstr->str));
-            return tlbstr;
-        }
-    }
+    if (offset < 0 || offset >= seg->length || offset % 4 || !table)
+        return NULL;
 
-    return NULL;
+    if ((tlbstr = table[offset / 4]))
+        TRACE_(typelib)("%s\n", debugstr_w(tlbstr->str));
+    return tlbstr;
 }
 
-static TLBString *MSFT_ReadString( TLBContext *pcx, int offset)
+static TLBString *MSFT_ReadName( TLBContext *pcx, int offset)
 {
-    TLBString *tlbstr;
-
-    LIST_FOR_EACH_ENTRY(tlbstr, &pcx->pLibInfo->string_list, TLBString, entry) {
-        if (tlbstr->offset == offset) {
-            TRACE_(typelib)("%s\n", debugstr_w(tlbstr->str));
-            return tlbstr;
-        }
-    }
+    return MSFT_LookupString(pcx->names, &pcx->pTblDir->pNametab, offset);
+}
 
-    return NULL;
+static TLBString *MSFT_ReadString( TLBContext *pcx, int offset)
+{
+    return MSFT_LookupString(pcx->strings, &pcx->pTblDir->pStringtab, offset);
 }
 
 /*
@@ -2762,6 +2870,9 @@ static HRESULT MSFT_ReadAllStrings(TLBContext *pcx)
     INT16 len_str, len_piece;
     int offs = 0, lengthInChars;
 
+    if (pcx->pTblDir->pStringtab.length > 0)
+        pcx->strings = calloc(pcx->pTblDir->pStringtab.length / 4 + 1, sizeof(*pcx->strings));
+
     MSFT_Seek(pcx, pcx->pTblDir->pStringtab.offset);
     while (1) {
         TLBString *tlbstr;
@@ -2796,6 +2907,7 @@ static HRESULT MSFT_ReadAllStrings(TLBContext *pcx)
         free(string);
 
         list_add_tail(&pcx->pLibInfo->string_list, &tlbstr->entry);
+        if (pcx->strings) pcx->strings[offs / 4] = tlbstr;
 
         offs += len_piece;
     }
@@ -3449,6 +3561,8 @@ static ITypeLib2* ITypeLib2_Constructor_MSFT(LPVOID pLib, DWORD dwTLBLength)
     cx.mapping = pLib;
     cx.pLibInfo = pTypeLibImpl;
     cx.length = dwTLBLength;
+    cx.names = cx.strings = NULL;
+    cx.guids = NULL;
 
     /* read header */
     MSFT_ReadLEDWords(&tlbHeader, sizeof(tlbHeader), &cx, 0);
@@ -3640,6 +3754,10 @@ static ITypeLib2* ITypeLib2_Constructor_MSFT(LPVOID pLib, DWORD dwTLBLength)
             TLB_fix_typeinfo_ptr_size(pTypeLibImpl->typeinfos[i]);
     }
 
+    free(cx.names);
+    free(cx.strings);
+    free(cx.guids);
+
     TRACE("(%p)\n", pTypeLibImpl);
     return &pTypeLibImpl->ITypeLib2_iface;
 }
@@ -5604,6 +5722,7 @@ static void ITypeInfoImpl_Destroy(ITypeInfoImpl *This)
         typeinfo_release_funcdesc(&This->funcdescs[i]);
     }
     free(This->funcdescs);
+    typeinfo_free_func_name_index(This);
 
     for(i = 0; i < This->typeattr.cVars; ++i)
     {
@@ -5643,7 +5762,10 @@ static ULONG WINAPI ITypeInfo_fnRelease(ITypeInfo2 *iface)
         BOOL not_attached_to_typelib = This->not_attached_to_typelib;
         ITypeLib2_Release(&This->pTypeLib->ITypeLib2_iface);
         if (not_attached_to_typelib)
+        {
+            typeinfo_free_func_name_index(This);
             free(This);
+        }
         /* otherwise This will be freed when typelib is freed */
     }
 
@@ -6257,9 +6379,10 @@ static HRESULT WINAPI ITypeInfo_fnGetIDsOfNames( ITypeInfo2 *iface,
         LPOLESTR  *rgszNames, UINT cNames, MEMBERID  *pMemId)
 {
     ITypeInfoImpl *This = impl_from_ITypeInfo2(iface);
+    const TLBFuncDesc *pFDesc;
     const TLBVarDesc *pVDesc;
     HRESULT ret=S_OK;
-    UINT i, fdc;
+    UINT i;
 
     TRACE("%p, %s, %d.\n", iface, debugstr_w(*rgszNames), cNames);
 
@@ -6267,23 +6390,20 @@ static HRESULT WINAPI ITypeInfo_fnGetIDsOfNames( ITypeInfo2 *iface,
     for (i = 0; i < cNames; i++)
         pMemId[i] = MEMBERID_NIL;
 
-    for (fdc = 0; fdc < This->typeattr.cFuncs; ++fdc) {
+    if ((pFDesc = typeinfo_find_func_by_name(This, *rgszNames))) {
         int j;
-        const TLBFuncDesc *pFDesc = &This->funcdescs[fdc];
-        if(!lstrcmpiW(*rgszNames, TLB_get_bstr(pFDesc->Name))) {
-            if(cNames) *pMemId=pFDesc->funcdesc.memid;
-            for(i=1; i < cNames; i++){
-                for(j=0; j<pFDesc->funcdesc.cParams; j++)
-                    if(!lstrcmpiW(rgszNames[i],TLB_get_bstr(pFDesc->pParamDesc[j].Name)))
-                            break;
-                if( j<pFDesc->funcdesc.cParams)
-                    pMemId[i]=j;
-                else
-                   ret=DISP_E_UNKNOWNNAME;
-            };
-            TRACE("-- %#lx.\n", ret);
-            return ret;
-        }
+        if(cNames) *pMemId=pFDesc->funcdesc.memid;
+        for(i=1; i < cNames; i++){
+            for(j=0; j<pFDesc->funcdesc.cParams; j++)
+                if(!lstrcmpiW(rgszNames[i],TLB_get_bstr(pFDesc->pParamDesc[j].Name)))
+                        break;
+            if( j<pFDesc->funcdesc.cParams)
+                pMemId[i]=j;
+            else
+               ret=DISP_E_UNKNOWNNAME;
+        };
+        TRACE("-- %#lx.\n", ret);
+        return ret;
     }
     pVDesc = TLB_get_vardesc_by_name(This, *rgszNames);
     if(pVDesc){
@@ -7768,6 +7888,7 @@ static HRESULT WINAPI ITypeInfo_fnGetRefTypeInfo(
 
         *pTypeInfoImpl = *This;
         pTypeInfoImpl->ref = 0;
+        pTypeInfoImpl->func_names = NULL;
         list_init(&pTypeInfoImpl->custdata_list);
 
         if (This->typeattr.typekind == TKIND_INTERFACE)
@@ -10653,6 +10774,7 @@ static HRESULT WINAPI ICreateTypeInfo2_fnAddFuncDesc(ICreateTypeInfo2 *iface,
     list_init(&func_desc->custdata_list);
 
     ++This->typeattr.cFuncs;
+    typeinfo_free_func_name_index(This);
 
     This->needs_layout = TRUE;
 
@@ -10852,6 +10974,7 @@ static HRESULT WINAPI ICreateTypeInfo2_fnSetFuncAndParamNames(ICreateTypeInfo2 *
     }
 
     func_desc->Name = TLB_append_str(&This->pTypeLib->name_list, *names);
+    typeinfo_free_func_name_index(This);
 
     for (i = 1; i < numNames; ++i) {
         TLBParDesc *par_desc = func_desc->pParamDesc + i - 1;
@@ -11152,6 +11275,7 @@ static HRESULT WINAPI ICreateTypeInfo2_fnDeleteFuncDesc(ICreateTypeInfo2 *iface,
     typeinfo_release_funcdesc(&This->funcdescs[index]);
 
     --This->typeattr.cFuncs;
+    typeinfo_free_func_name_index(This);
     if (index != This->typeattr.cFuncs)
     {
         memmove(This->funcdescs + index, This->funcdescs + index + 1,
@@ -27,8 +27,17 @@
 #include "winbase.h"
 #include "winternl.h"
 #include "wingdi.h"
+#include "wine/unixlib.h"
 
 extern const void *extension_procs[];
+extern const char *const unix_call_names[];
+extern LONG *unix_call_counts;
+
+static inline NTSTATUS counted_unix_call( unsigned int code, void *params )
+{
+    if (unix_call_counts) InterlockedIncrement( &unix_call_counts[code] );
+    return WINE_UNIX_CALL( code, params );
+}
 
 extern int WINAPI wglDescribePixelFormat( HDC hdc, int ipfd, UINT cjpfd, PIXELFORMATDESCRIPTOR *ppfd );
 
@@ -28398,6 +28398,6 @@ struct gl_debug_message_callback_params
     char message[1];
 };
 
-#define UNIX_CALL( func, params ) WINE_UNIX_CALL( unix_ ## func, params )
+#define UNIX_CALL( func, params ) counted_unix_call( unix_ ## func, params )
 
 #endif /* __WINE_OPENGL32_UNIXLIB_H */
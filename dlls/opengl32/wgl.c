@@ -40,6 +40,10 @@
 
 WINE_DEFAULT_DEBUG_CHANNEL(opengl);
 WINE_DECLARE_DEBUG_CHANNEL(fps);
+WINE_DECLARE_DEBUG_CHANNEL(glcalls);
+
+/* per entry point count of PE to Unix transitions, only allocated when tracing them */
+LONG *unix_call_counts;
 
 static const MAT2 identity = { {0,1},{0,0},{0,0},{0,1} };
 
@@ -908,6 +912,31 @@ INT WINAPI wglGetPixelFormat(HDC hdc)
     return args.ret;
 }
 
+static void trace_unix_calls(void)
+{
+    static DWORD prev_time;
+    static unsigned long frames;
+    DWORD time = GetTickCount();
+    unsigned long total = 0;
+    unsigned int i;
+    LONG count;
+
+    frames++;
+    /* every 1.5 seconds */
+    if (time - prev_time <= 1500) return;
+
+    for (i = 0; i < funcs_count; i++)
+    {
+        if (!(count = InterlockedExchange( &unix_call_counts[i], 0 ))) continue;
+        TRACE_(glcalls)( "%s: %ld calls, %.1f per frame\n", unix_call_names[i], count, (double)count / frames );
+        total += count;
+    }
+    TRACE_(glcalls)( "@ %lu calls in %lu frames, %.1f per frame\n", total, frames, (double)total / frames );
+
+    prev_time = time;
+    frames = 0;
+}
+
 /***********************************************************************
  *              wglSwapBuffers (OPENGL32.@)
  */
@@ -917,7 +946,9 @@ BOOL WINAPI DECLSPEC_HOTPATCH wglSwapBuffers( HDC hdc )
     NTSTATUS status;
 
     if ((status = UNIX_CALL( wglSwapBuffers, &args ))) WARN( "wglSwapBuffers returned %#lx\n", status );
-    else if (TRACE_ON(fps))
+    else if (unix_call_counts) trace_unix_calls();
+
+    if (!status && TRACE_ON(fps))
     {
         static long prev_time, start_time;
         static unsigned long frames, frames_total;
@@ -1676,13 +1707,13 @@ static void *gl_map_buffer( enum unix_funcs code, GLenum target, GLenum access )
 
     TRACE( "target %d, access %d\n", target, access );
 
-    if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+    if (!(status = counted_unix_call( code, &args ))) return args.ret;
 #ifndef _WIN64
     if (status == STATUS_INVALID_ADDRESS)
     {
         TRACE( "Unable to map wow64 buffer directly, using copy buffer!\n" );
         if (!(args.ret = _aligned_malloc( (size_t)args.ret, 16 ))) status = STATUS_NO_MEMORY;
-        else if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+        else if (!(status = counted_unix_call( code, &args ))) return args.ret;
         _aligned_free( args.ret );
     }
 #endif
@@ -1740,13 +1771,13 @@ static void *gl_map_named_buffer( enum unix_funcs code, GLuint buffer, GLenum ac
 
     TRACE( "(%d, %d)\n", buffer, access );
 
-    if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+    if (!(status = counted_unix_call( code, &args ))) return args.ret;
 #ifndef _WIN64
     if (status == STATUS_INVALID_ADDRESS)
     {
         TRACE( "Unable to map wow64 buffer directly, using copy buffer!\n" );
         if (!(args.ret = _aligned_malloc( (size_t)args.ret, 16 ))) status = STATUS_NO_MEMORY;
-        else if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+        else if (!(status = counted_unix_call( code, &args ))) return args.ret;
         _aligned_free( args.ret );
     }
 #endif
@@ -1778,13 +1809,13 @@ static void *gl_map_named_buffer_range( enum unix_funcs code, GLuint buffer, GLi
 
     TRACE( "buffer %d, offset %Id, length %Id, access %d\n", buffer, offset, length, access );
 
-    if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+    if (!(status = counted_unix_call( code, &args ))) return args.ret;
 #ifndef _WIN64
     if (status == STATUS_INVALID_ADDRESS)
     {
         TRACE( "Unable to map wow64 buffer directly, using copy buffer!\n" );
         if (!(args.ret = _aligned_malloc( length, 16 ))) status = STATUS_NO_MEMORY;
-        else if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+        else if (!(status = counted_unix_call( code, &args ))) return args.ret;
         _aligned_free( args.ret );
     }
 #endif
@@ -1816,7 +1847,7 @@ static GLboolean gl_unmap_buffer( enum unix_funcs code, GLenum target )
 
     TRACE( "target %d\n", target );
 
-    if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+    if (!(status = counted_unix_call( code, &args ))) return args.ret;
 #ifndef _WIN64
     if (status == STATUS_INVALID_ADDRESS)
     {
@@ -1853,7 +1884,7 @@ static GLboolean gl_unmap_named_buffer( enum unix_funcs code, GLuint buffer )
 
     TRACE( "buffer %d\n", buffer );
 
-    if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+    if (!(status = counted_unix_call( code, &args ))) return args.ret;
 #ifndef _WIN64
     if (status == STATUS_INVALID_ADDRESS)
     {
@@ -1902,6 +1933,8 @@ BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, LPVOID reserved )
     switch(reason)
     {
     case DLL_PROCESS_ATTACH:
+        if (TRACE_ON(glcalls)) unix_call_counts = calloc( funcs_count, sizeof(*unix_call_counts) );
+
         if ((status = __wine_init_unix_call()) ||
             (status = UNIX_CALL( process_attach, &params )))
         {
@@ -1924,6 +1957,8 @@ BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, LPVOID reserved )
 #ifndef _WIN64
         cleanup_wow64_strings();
 #endif
+        free( unix_call_counts );
+        unix_call_counts = NULL;
         /* fallthrough */
     case DLL_THREAD_DETACH:
         free( NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_FORMATS_PTR] );
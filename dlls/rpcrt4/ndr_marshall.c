@@ -2838,17 +2838,67 @@ static ULONG EmbeddedComplexMemorySize(PMIDL_STUB_MESSAGE pStubMsg,
 }
 
 
+/* Returns the size of a run of base type members starting at *ppFormat
+ * which have the same layout in memory and in the buffer, and moves
+ * *ppFormat past it. Alignment is expressed by separate FC_ALIGNM* codes,
+ * so such members are contiguous on both sides and can be copied at once. */
+static ULONG get_simple_member_run(PFORMAT_STRING *ppFormat)
+{
+  PFORMAT_STRING pFormat = *ppFormat;
+  ULONG size = 0;
+
+  for (;; pFormat++) {
+    switch (*pFormat) {
+    case FC_BYTE:
+    case FC_CHAR:
+    case FC_SMALL:
+    case FC_USMALL:
+      size += 1;
+      continue;
+    case FC_WCHAR:
+    case FC_SHORT:
+    case FC_USHORT:
+      size += 2;
+      continue;
+    case FC_LONG:
+    case FC_ULONG:
+    case FC_ENUM32:
+    case FC_FLOAT:
+      size += 4;
+      continue;
+    case FC_HYPER:
+    case FC_DOUBLE:
+      size += 8;
+      continue;
+    }
+    break;
+  }
+
+  *ppFormat = pFormat;
+  return size;
+}
+
 static unsigned char * ComplexMarshall(PMIDL_STUB_MESSAGE pStubMsg,
                                        unsigned char *pMemory,
                                        PFORMAT_STRING pFormat,
                                        PFORMAT_STRING pPointer)
 {
   unsigned char *mem_base = pMemory;
-  PFORMAT_STRING desc;
+  PFORMAT_STRING desc, run_end;
   NDR_MARSHALL m;
   ULONG size;
 
   while (*pFormat != FC_END) {
+    run_end = pFormat;
+    size = get_simple_member_run(&run_end);
+    if (run_end - pFormat > 1) {
+      TRACE("%Id simple members, %lu bytes <= %p\n", run_end - pFormat, size, pMemory);
+      safe_copy_to_buffer(pStubMsg, pMemory, size);
+      pMemory += size;
+      pFormat = run_end;
+      continue;
+    }
+
     switch (*pFormat) {
     case FC_BYTE:
     case FC_CHAR:
@@ -3004,11 +3054,21 @@ static unsigned char * ComplexUnmarshall(PMIDL_STUB_MESSAGE pStubMsg,
                                          unsigned char fMustAlloc)
 {
   unsigned char *mem_base = pMemory;
-  PFORMAT_STRING desc;
+  PFORMAT_STRING desc, run_end;
   NDR_UNMARSHALL m;
   ULONG size;
 
   while (*pFormat != FC_END) {
+    run_end = pFormat;
+    size = get_simple_member_run(&run_end);
+    if (run_end - pFormat > 1) {
+      safe_copy_from_buffer(pStubMsg, pMemory, size);
+      TRACE("%Id simple members, %lu bytes => %p\n", run_end - pFormat, size, pMemory);
+      pMemory += size;
+      pFormat = run_end;
+      continue;
+    }
+
     switch (*pFormat) {
     case FC_BYTE:
     case FC_CHAR:
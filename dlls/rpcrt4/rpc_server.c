@@ -104,6 +104,12 @@ static LONG listen_count;
 /* event set once all manual listening is finished */
 static HANDLE listen_done_event;
 
+/* maximum number of calls dispatched concurrently, as given to RpcServerListen */
+static UINT max_calls = RPC_C_LISTEN_MAX_CALLS_DEFAULT;
+static UINT active_calls;
+static SRWLOCK calls_lock = SRWLOCK_INIT;
+static CONDITION_VARIABLE calls_cv = CONDITION_VARIABLE_INIT;
+
 static UUID uuid_nil;
 
 static inline RpcObjTypeMap *LookupObjTypeMap(UUID *ObjUuid)
@@ -530,6 +536,25 @@ static void RPCRT4_process_packet(RpcConnection* conn, RpcPktHdr* hdr,
   free(auth_data);
 }
 
+/* Requests beyond the limit are held back in the connection's I/O thread,
+ * which stops reading further packets from it until a call finishes. */
+static void acquire_call_slot(void)
+{
+  AcquireSRWLockExclusive(&calls_lock);
+  while (active_calls >= max_calls)
+    SleepConditionVariableSRW(&calls_cv, &calls_lock, INFINITE, 0);
+  active_calls++;
+  ReleaseSRWLockExclusive(&calls_lock);
+}
+
+static void release_call_slot(void)
+{
+  AcquireSRWLockExclusive(&calls_lock);
+  active_calls--;
+  ReleaseSRWLockExclusive(&calls_lock);
+  WakeConditionVariable(&calls_cv);
+}
+
 static DWORD CALLBACK RPCRT4_worker_thread(LPVOID the_arg)
 {
   RpcPacket *pkt = the_arg;
@@ -537,6 +562,7 @@ static DWORD CALLBACK RPCRT4_worker_thread(LPVOID the_arg)
                         pkt->auth_length);
   RPCRT4_ReleaseConnection(pkt->conn);
   free(pkt);
+  release_call_slot();
   return 0;
 }
 
@@ -588,8 +614,11 @@ static DWORD CALLBACK RPCRT4_io_thread(LPVOID the_arg)
       packet->msg = msg;
       packet->auth_data = auth_data;
       packet->auth_length = auth_length;
+      acquire_call_slot();
       if (!QueueUserWorkItem(RPCRT4_worker_thread, packet, WT_EXECUTELONGFUNCTION)) {
         ERR("couldn't queue work item for worker thread, error was %ld\n", GetLastError());
+        release_call_slot();
+        RPCRT4_ReleaseConnection(packet->conn);
         free(packet);
         status = RPC_S_OUT_OF_RESOURCES;
       } else {
@@ -1531,8 +1560,17 @@ RPC_STATUS WINAPI RpcServerListen( UINT MinimumCallThreads, UINT MaxCalls, UINT
     return RPC_S_NO_PROTSEQS_REGISTERED;
 
   status = RPCRT4_start_listen(FALSE);
+  if (status != RPC_S_OK) return status;
+
+  if (MaxCalls)
+  {
+    AcquireSRWLockExclusive(&calls_lock);
+    max_calls = MaxCalls;
+    ReleaseSRWLockExclusive(&calls_lock);
+    WakeAllConditionVariable(&calls_cv);
+  }
 
-  if (DontWait || (status != RPC_S_OK)) return status;
+  if (DontWait) return status;
 
   return RpcMgmtWaitServerListen();
 }
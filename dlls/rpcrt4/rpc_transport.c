@@ -68,6 +68,11 @@ typedef struct _RpcConnection_np
     IO_STATUS_BLOCK io_status;
     HANDLE event_cache;
     BOOL read_closed;
+    /* data read ahead from the pipe, the rest of the message is still pending if read_more is set */
+    BOOL read_more;
+    unsigned int read_pos;
+    unsigned int read_len;
+    char read_buf[RPC_MAX_PACKET_SIZE];
 } RpcConnection_np;
 
 static RpcConnection *rpcrt4_conn_np_alloc(void)
@@ -372,9 +377,8 @@ static RPC_STATUS rpcrt4_ncalrpc_handoff(RpcConnection *old_conn, RpcConnection
   return status;
 }
 
-static int rpcrt4_conn_np_read(RpcConnection *conn, void *buffer, unsigned int count)
+static int rpcrt4_conn_np_read_pipe(RpcConnection_np *connection, void *buffer, unsigned int count, BOOL *more)
 {
-    RpcConnection_np *connection = (RpcConnection_np *) conn;
     HANDLE event;
     NTSTATUS status;
 
@@ -398,9 +402,48 @@ static int rpcrt4_conn_np_read(RpcConnection *conn, void *buffer, unsigned int c
         status = connection->io_status.Status;
     }
     release_np_event(connection, event);
+    *more = status == STATUS_BUFFER_OVERFLOW;
     return status && status != STATUS_BUFFER_OVERFLOW ? -1 : connection->io_status.Information;
 }
 
+/* Packets are read in several small pieces, header first. Pipes are in message
+ * mode, so we read whole messages ahead and serve the pieces from the buffer,
+ * saving a server round trip for each of them. */
+static int rpcrt4_conn_np_read(RpcConnection *conn, void *buffer, unsigned int count)
+{
+    RpcConnection_np *connection = (RpcConnection_np *) conn;
+    unsigned int copied = 0;
+    int ret;
+
+    if (connection->read_len)
+    {
+        copied = min(count, connection->read_len);
+        memcpy(buffer, connection->read_buf + connection->read_pos, copied);
+        connection->read_pos += copied;
+        connection->read_len -= copied;
+        if (copied == count || !connection->read_more)
+            return copied;
+        buffer = (char *)buffer + copied;
+        count -= copied;
+    }
+
+    if (!count || count >= sizeof(connection->read_buf))
+    {
+        ret = rpcrt4_conn_np_read_pipe(connection, buffer, count, &connection->read_more);
+        return ret == -1 ? -1 : ret + copied;
+    }
+
+    ret = rpcrt4_conn_np_read_pipe(connection, connection->read_buf, sizeof(connection->read_buf),
+                                   &connection->read_more);
+    if (ret == -1)
+        return -1;
+
+    connection->read_pos = min(count, ret);
+    connection->read_len = ret - connection->read_pos;
+    memcpy(buffer, connection->read_buf, connection->read_pos);
+    return connection->read_pos + copied;
+}
+
 static int rpcrt4_conn_np_write(RpcConnection *conn, const void *buffer, unsigned int count)
 {
     RpcConnection_np *connection = (RpcConnection_np *) conn;
@@ -559,6 +559,144 @@ static HRESULT compile_unary_expression(compile_ctx_t *ctx, unary_expression_t *
     return push_instr(ctx, op) ? S_OK : E_OUTOFMEMORY;
 }
 
+/* Replaces the code emitted since start with a single literal instruction
+ * holding v, if the value can be represented by one. */
+static HRESULT push_constant_value(compile_ctx_t *ctx, unsigned start, VARIANT *v, BOOL *folded)
+{
+    *folded = FALSE;
+
+    switch(V_VT(v)) {
+    case VT_I2:
+        *folded = TRUE;
+        break;
+    case VT_I4:
+        /* OP_int would push small values as VT_I2 */
+        *folded = V_I4(v) != (INT16)V_I4(v);
+        break;
+    case VT_R8:
+        *folded = TRUE;
+        break;
+    case VT_BSTR:
+        /* OP_string can't hold embedded nulls */
+        *folded = SysStringLen(V_BSTR(v)) == lstrlenW(V_BSTR(v));
+        break;
+    default:
+        break;
+    }
+    if(!*folded)
+        return S_OK;
+
+    ctx->instr_cnt = start;
+    switch(V_VT(v)) {
+    case VT_I2:
+        return push_instr_int(ctx, OP_int, V_I2(v));
+    case VT_I4:
+        return push_instr_int(ctx, OP_int, V_I4(v));
+    case VT_R8:
+        return push_instr_double(ctx, OP_double, V_R8(v));
+    default:
+        return push_instr_str(ctx, OP_string, V_BSTR(v));
+    }
+}
+
+/* Compiles an expression which may be built only from literals. If it is, its
+ * value is computed with the same variant functions as the interpreter and
+ * returned in v, and the code is replaced by a single literal instruction when
+ * possible. Otherwise, or if the evaluation fails, v is left VT_EMPTY and the
+ * operation is left for run time. Each node is evaluated once, from the values
+ * reported by its children. */
+static HRESULT compile_constant_expression(compile_ctx_t *ctx, expression_t *expr, VARIANT *v)
+{
+    unsigned start = ctx->instr_cnt;
+    VARIANT l, r;
+    BOOL folded;
+    HRESULT hres;
+    vbsop_t op;
+
+    V_VT(v) = VT_EMPTY;
+
+    switch(expr->type) {
+    case EXPR_BRACKETS:
+        return compile_constant_expression(ctx, ((unary_expression_t*)expr)->subexpr, v);
+    case EXPR_INT: {
+        LONG value = ((int_expression_t*)expr)->value;
+
+        /* Same as interp_int */
+        if(value == (INT16)value) {
+            V_VT(v) = VT_I2;
+            V_I2(v) = value;
+        }else {
+            V_VT(v) = VT_I4;
+            V_I4(v) = value;
+        }
+        return push_instr_int(ctx, OP_int, value);
+    }
+    case EXPR_DOUBLE:
+        V_VT(v) = VT_R8;
+        V_R8(v) = ((double_expression_t*)expr)->value;
+        return push_instr_double(ctx, OP_double, V_R8(v));
+    case EXPR_STRING:
+        hres = push_instr_str(ctx, OP_string, ((string_expression_t*)expr)->value);
+        if(SUCCEEDED(hres) && (V_BSTR(v) = SysAllocString(((string_expression_t*)expr)->value)))
+            V_VT(v) = VT_BSTR;
+        return hres;
+    case EXPR_NEG:
+        hres = compile_constant_expression(ctx, ((unary_expression_t*)expr)->subexpr, &l);
+        if(FAILED(hres))
+            return hres;
+        if(V_VT(&l) != VT_EMPTY && V_VT(&l) != VT_BSTR && FAILED(VarNeg(&l, v)))
+            V_VT(v) = VT_EMPTY;
+        VariantClear(&l);
+        op = OP_neg;
+        break;
+    case EXPR_ADD:
+    case EXPR_CONCAT:
+    case EXPR_MUL:
+    case EXPR_SUB:
+        hres = compile_constant_expression(ctx, ((binary_expression_t*)expr)->left, &l);
+        if(FAILED(hres))
+            return hres;
+        hres = compile_constant_expression(ctx, ((binary_expression_t*)expr)->right, &r);
+        if(FAILED(hres)) {
+            VariantClear(&l);
+            return hres;
+        }
+
+        /* Conversions between strings and numbers depend on the locale,
+         * which the script may change before this code runs. */
+        if(V_VT(&l) == VT_EMPTY || V_VT(&r) == VT_EMPTY
+           || (V_VT(&l) == VT_BSTR) != (expr->type == EXPR_CONCAT) || (V_VT(&r) == VT_BSTR) != (expr->type == EXPR_CONCAT))
+            hres = E_FAIL;
+        else switch(expr->type) {
+        case EXPR_ADD:    hres = VarAdd(&l, &r, v); break;
+        case EXPR_CONCAT: hres = VarCat(&l, &r, v); break;
+        case EXPR_MUL:    hres = VarMul(&l, &r, v); break;
+        default:          hres = VarSub(&l, &r, v); break;
+        }
+        if(FAILED(hres))
+            V_VT(v) = VT_EMPTY;
+        VariantClear(&l);
+        VariantClear(&r);
+
+        switch(expr->type) {
+        case EXPR_ADD:    op = OP_add; break;
+        case EXPR_CONCAT: op = OP_concat; break;
+        case EXPR_MUL:    op = OP_mul; break;
+        default:          op = OP_sub; break;
+        }
+        break;
+    default:
+        return compile_expression(ctx, expr);
+    }
+
+    hres = push_constant_value(ctx, start, v, &folded);
+    if(SUCCEEDED(hres) && !folded && !push_instr(ctx, op))
+        hres = E_OUTOFMEMORY;
+    if(FAILED(hres))
+        VariantClear(v);
+    return hres;
+}
+
 static HRESULT compile_binary_expression(compile_ctx_t *ctx, binary_expression_t *expr, vbsop_t op)
 {
     HRESULT hres;
@@ -576,9 +714,18 @@ static HRESULT compile_binary_expression(compile_ctx_t *ctx, binary_expression_t
 
 static HRESULT compile_expression(compile_ctx_t *ctx, expression_t *expr)
 {
+    VARIANT v;
+    HRESULT hres;
+
     switch(expr->type) {
     case EXPR_ADD:
-        return compile_binary_expression(ctx, (binary_expression_t*)expr, OP_add);
+    case EXPR_CONCAT:
+    case EXPR_MUL:
+    case EXPR_NEG:
+    case EXPR_SUB:
+        hres = compile_constant_expression(ctx, expr, &v);
+        VariantClear(&v);
+        return hres;
     case EXPR_AND:
         return compile_binary_expression(ctx, (binary_expression_t*)expr, OP_and);
     case EXPR_BOOL:
@@ -587,8 +734,6 @@ static HRESULT compile_expression(compile_ctx_t *ctx, expression_t *expr)
         return compile_expression(ctx, ((unary_expression_t*)expr)->subexpr);
     case EXPR_CALL:
         return compile_call_expression(ctx, (call_expression_t*)expr, TRUE);
-    case EXPR_CONCAT:
-        return compile_binary_expression(ctx, (binary_expression_t*)expr, OP_concat);
     case EXPR_DATE:
         return push_instr_date(ctx, OP_date, ((date_expression_t*)expr)->value);
     case EXPR_DIV:
@@ -625,10 +770,6 @@ static HRESULT compile_expression(compile_ctx_t *ctx, expression_t *expr)
         return compile_member_expression(ctx, (member_expression_t*)expr);
     case EXPR_MOD:
         return compile_binary_expression(ctx, (binary_expression_t*)expr, OP_mod);
-    case EXPR_MUL:
-        return compile_binary_expression(ctx, (binary_expression_t*)expr, OP_mul);
-    case EXPR_NEG:
-        return compile_unary_expression(ctx, (unary_expression_t*)expr, OP_neg);
     case EXPR_NEQUAL:
         return compile_binary_expression(ctx, (binary_expression_t*)expr, OP_nequal);
     case EXPR_NEW:
@@ -645,8 +786,6 @@ static HRESULT compile_expression(compile_ctx_t *ctx, expression_t *expr)
         return compile_binary_expression(ctx, (binary_expression_t*)expr, OP_or);
     case EXPR_STRING:
         return push_instr_str(ctx, OP_string, ((string_expression_t*)expr)->value);
-    case EXPR_SUB:
-        return compile_binary_expression(ctx, (binary_expression_t*)expr, OP_sub);
     case EXPR_INT:
         return push_instr_int(ctx, OP_int, ((int_expression_t*)expr)->value);
     case EXPR_XOR:
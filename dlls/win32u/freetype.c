@@ -1300,21 +1300,14 @@ static void unix_face_destroy( struct unix_face *This )
     free( This );
 }
 
-static int add_unix_face( const char *unix_name, const WCHAR *file, void *data_ptr, SIZE_T data_size,
-                          DWORD face_index, DWORD flags, DWORD *num_faces )
+static int add_gdi_unix_face( struct unix_face *unix_face, const char *unix_name, const WCHAR *file,
+                              void *data_ptr, SIZE_T data_size, DWORD face_index, DWORD flags )
 {
-    struct unix_face *unix_face;
     int ret;
 
-    if (num_faces) *num_faces = 0;
-
-    if (!(unix_face = unix_face_create( unix_name, data_ptr, data_size, face_index, flags )))
-        return 0;
-
     if (unix_face->family_name[0] == '.') /* Ignore fonts with names beginning with a dot */
     {
         TRACE("Ignoring %s since its family name begins with a dot\n", debugstr_a(unix_name));
-        unix_face_destroy( unix_face );
         return 0;
     }
 
@@ -1329,6 +1322,22 @@ static int add_unix_face( const char *unix_name, const WCHAR *file, void *data_p
           (int)unix_face->fs.fsUsb[0], (int)unix_face->fs.fsUsb[1],
           (int)unix_face->fs.fsUsb[2], (int)unix_face->fs.fsUsb[3]);
 
+    return ret;
+}
+
+static int add_unix_face( const char *unix_name, const WCHAR *file, void *data_ptr, SIZE_T data_size,
+                          DWORD face_index, DWORD flags, DWORD *num_faces )
+{
+    struct unix_face *unix_face;
+    int ret;
+
+    if (num_faces) *num_faces = 0;
+
+    if (!(unix_face = unix_face_create( unix_name, data_ptr, data_size, face_index, flags )))
+        return 0;
+
+    ret = add_gdi_unix_face( unix_face, unix_name, file, data_ptr, data_size, face_index, flags );
+
     if (num_faces) *num_faces = unix_face->num_faces;
     unix_face_destroy( unix_face );
     return ret;
@@ -1532,9 +1541,297 @@ static FcPattern *create_family_pattern( const char *name, FcPattern **cached )
     return ret;
 }
 
-static void fontconfig_add_font( FcPattern *pattern, UINT flags )
+/* The faces found in each fontconfig directory are cached in the registry, keyed by
+ * directory name and validated against the directory modification time and the
+ * locale used for the face names, so that the font files don't need to be opened
+ * and parsed again on every startup. */
+
+#define FONT_DIR_CACHE_VERSION 2
+
+struct font_dir_cache_header
+{
+    DWORD     version;
+    DWORD     count;
+    ULONGLONG mtime;
+    LCID      lcid;
+    DWORD     reserved;
+};
+
+struct font_dir_cache_entry
+{
+    DWORD                   size;        /* total size of the entry, including names */
+    DWORD                   face_index;
+    DWORD                   valid;       /* FALSE if the face couldn't be loaded */
+    DWORD                   scalable;
+    DWORD                   num_faces;
+    DWORD                   ntm_flags;
+    DWORD                   weight;
+    DWORD                   font_version;
+    FONTSIGNATURE           fs;
+    struct bitmap_font_size size_info;
+    WORD                    name_len[5]; /* unix, family, second, style and full names, including null */
+    WCHAR                   names[1];
+};
+
+struct font_dir_cache
+{
+    HKEY       key;
+    WCHAR     *name;
+    ULONGLONG  mtime;
+    KEY_VALUE_PARTIAL_INFORMATION *info; /* cached data read from the registry */
+    DWORD      pos;                      /* offset of the next entry to look at */
+    char      *data;                     /* data to be written back */
+    DWORD      size;
+    DWORD      capacity;
+    DWORD      count;
+    BOOL       dirty;
+};
+
+static HKEY font_dir_cache_key;
+
+static WCHAR *font_dir_cache_name( const char *str )
+{
+    DWORD i, len = strlen( str );
+    WCHAR *ret;
+
+    /* map bytes directly, we only need the name to be unique */
+    if (!(ret = malloc( (len + 1) * sizeof(WCHAR) ))) return NULL;
+    for (i = 0; i <= len; i++) ret[i] = (unsigned char)str[i];
+    return ret;
+}
+
+static void font_dir_cache_init( struct font_dir_cache *cache, const char *dir )
+{
+    struct font_dir_cache_header header;
+    KEY_VALUE_PARTIAL_INFORMATION *info;
+    UNICODE_STRING nameW;
+    NTSTATUS status;
+    struct stat st;
+    ULONG size = 16384;
+
+    memset( cache, 0, sizeof(*cache) );
+    if (!(cache->key = font_dir_cache_key)) return;
+    if (stat( dir, &st ) == -1 || !(cache->name = font_dir_cache_name( dir ))) goto invalid;
+    cache->mtime = st.st_mtime;
+
+    RtlInitUnicodeString( &nameW, cache->name );
+    for (;;)
+    {
+        if (!(info = realloc( cache->info, size ))) goto invalid;
+        cache->info = info;
+        status = NtQueryValueKey( cache->key, &nameW, KeyValuePartialInformation, info, size, &size );
+        if (status != STATUS_BUFFER_OVERFLOW) break;
+    }
+    if (status) goto invalid;
+
+    if (cache->info->Type != REG_BINARY || cache->info->DataLength < sizeof(header)) goto invalid;
+    /* registry data is not guaranteed to be aligned */
+    memcpy( &header, cache->info->Data, sizeof(header) );
+    if (header.version != FONT_DIR_CACHE_VERSION || header.mtime != cache->mtime || header.lcid != system_lcid)
+    {
+        TRACE( "cache for %s is outdated\n", debugstr_a(dir) );
+        goto invalid;
+    }
+
+    cache->pos = sizeof(header);
+    return;
+
+invalid:
+    free( cache->info );
+    cache->info = NULL;
+    cache->dirty = TRUE;
+}
+
+static const struct font_dir_cache_entry *font_dir_cache_next( struct font_dir_cache *cache, DWORD *pos )
+{
+    const struct font_dir_cache_entry *entry;
+    DWORD i, len = 0;
+
+    if (*pos + offsetof( struct font_dir_cache_entry, names ) > cache->info->DataLength) return NULL;
+    entry = (const struct font_dir_cache_entry *)(cache->info->Data + *pos);
+    for (i = 0; i < ARRAY_SIZE(entry->name_len); i++) len += entry->name_len[i];
+    if (entry->size < offsetof( struct font_dir_cache_entry, names[len] ) ||
+        entry->size > cache->info->DataLength - *pos || !entry->name_len[0])
+        return NULL;
+    *pos += entry->size;
+    return entry;
+}
+
+static BOOL font_dir_cache_match( const struct font_dir_cache_entry *entry, const char *unix_name, DWORD face_index )
+{
+    DWORD i;
+
+    if (entry->face_index != face_index) return FALSE;
+    for (i = 0; i < entry->name_len[0]; i++)
+        if (entry->names[i] != (unsigned char)unix_name[i]) return FALSE;
+    return TRUE;
+}
+
+static WCHAR *font_dir_cache_strdup( const WCHAR *str, WORD len )
+{
+    WCHAR *ret;
+    if (!len || !(ret = malloc( len * sizeof(WCHAR) ))) return NULL;
+    memcpy( ret, str, len * sizeof(WCHAR) );
+    ret[len - 1] = 0;
+    return ret;
+}
+
+/* returns TRUE if the face was found in the cache; *ret is then NULL if it isn't a valid face */
+static BOOL font_dir_cache_lookup( struct font_dir_cache *cache, const char *unix_name, DWORD face_index,
+                                   struct unix_face **ret )
+{
+    const struct font_dir_cache_entry *entry;
+    struct unix_face *This;
+    const WCHAR *name;
+    DWORD pos;
+
+    if (!cache->info) return FALSE;
+
+    /* faces are usually enumerated in the same order they were cached */
+    pos = cache->pos;
+    while ((entry = font_dir_cache_next( cache, &pos )) && !font_dir_cache_match( entry, unix_name, face_index ));
+    if (!entry)
+    {
+        pos = sizeof(struct font_dir_cache_header);
+        while ((entry = font_dir_cache_next( cache, &pos )) && !font_dir_cache_match( entry, unix_name, face_index ));
+        if (!entry) return FALSE;
+    }
+    cache->pos = pos;
+
+    *ret = NULL;
+    if (!entry->valid) return TRUE;
+    if (!(This = calloc( 1, sizeof(*This) ))) return FALSE;
+
+    This->scalable = entry->scalable;
+    This->num_faces = entry->num_faces;
+    This->ntm_flags = entry->ntm_flags;
+    This->weight = entry->weight;
+    This->font_version = entry->font_version;
+    This->fs = entry->fs;
+    This->size = entry->size_info;
+
+    name = entry->names + entry->name_len[0];
+    This->family_name = font_dir_cache_strdup( name, entry->name_len[1] );
+    name += entry->name_len[1];
+    This->second_name = font_dir_cache_strdup( name, entry->name_len[2] );
+    name += entry->name_len[2];
+    This->style_name = font_dir_cache_strdup( name, entry->name_len[3] );
+    name += entry->name_len[3];
+    This->full_name = font_dir_cache_strdup( name, entry->name_len[4] );
+
+    if (!This->family_name)
+    {
+        unix_face_destroy( This );
+        return FALSE;
+    }
+
+    *ret = This;
+    return TRUE;
+}
+
+static void font_dir_cache_add( struct font_dir_cache *cache, const char *unix_name, DWORD face_index,
+                                const struct unix_face *face )
+{
+    const WCHAR *names[4] = {0};
+    struct font_dir_cache_entry *entry;
+    DWORD i, size, len[5];
+    WCHAR *ptr;
+
+    if (!cache->key) return;
+
+    len[0] = strlen( unix_name ) + 1;
+    if (face)
+    {
+        names[0] = face->family_name;
+        names[1] = face->second_name;
+        names[2] = face->style_name;
+        names[3] = face->full_name;
+    }
+    for (i = 0; i < ARRAY_SIZE(names); i++) len[i + 1] = names[i] ? lstrlenW( names[i] ) + 1 : 0;
+    for (i = 0; i < ARRAY_SIZE(len); i++) if (len[i] > 0xffff) return;
+
+    size = offsetof( struct font_dir_cache_entry, names[len[0] + len[1] + len[2] + len[3] + len[4]] );
+    size = (size + 7) & ~7;
+
+    if (!cache->data) cache->size = sizeof(struct font_dir_cache_header);
+    if (cache->size + size > cache->capacity)
+    {
+        DWORD capacity = max( cache->capacity * 2, cache->size + size + 4096 );
+        char *data;
+
+        if (!(data = realloc( cache->data, capacity ))) return;
+        cache->data = data;
+        cache->capacity = capacity;
+    }
+
+    entry = (struct font_dir_cache_entry *)(cache->data + cache->size);
+    memset( entry, 0, size );
+    entry->size = size;
+    entry->face_index = face_index;
+    if ((entry->valid = !!face))
+    {
+        entry->scalable = face->scalable;
+        entry->num_faces = face->num_faces;
+        entry->ntm_flags = face->ntm_flags;
+        entry->weight = face->weight;
+        entry->font_version = face->font_version;
+        entry->fs = face->fs;
+        entry->size_info = face->size;
+    }
+
+    ptr = entry->names;
+    for (i = 0; i < len[0]; i++) *ptr++ = (unsigned char)unix_name[i];
+    entry->name_len[0] = len[0];
+    for (i = 0; i < ARRAY_SIZE(names); i++)
+    {
+        if (names[i]) memcpy( ptr, names[i], len[i + 1] * sizeof(WCHAR) );
+        ptr += len[i + 1];
+        entry->name_len[i + 1] = len[i + 1];
+    }
+
+    cache->size += size;
+    cache->count++;
+}
+
+static void font_dir_cache_release( struct font_dir_cache *cache )
+{
+    struct font_dir_cache_header empty, *header = cache->data ? (void *)cache->data : &empty;
+
+    if (cache->dirty && cache->name)
+    {
+        if (!cache->data) cache->size = sizeof(*header);
+        header->version = FONT_DIR_CACHE_VERSION;
+        header->count = cache->count;
+        header->mtime = cache->mtime;
+        header->lcid = system_lcid;
+        header->reserved = 0;
+        set_reg_value( cache->key, cache->name, REG_BINARY, header, cache->size );
+    }
+
+    free( cache->info );
+    free( cache->data );
+    free( cache->name );
+}
+
+static struct unix_face *font_dir_cache_get_face( struct font_dir_cache *cache, const char *unix_name,
+                                                  DWORD face_index, DWORD flags )
+{
+    struct unix_face *unix_face;
+
+    if (!font_dir_cache_lookup( cache, unix_name, face_index, &unix_face ))
+    {
+        TRACE( "loading %s index %u\n", debugstr_a(unix_name), (int)face_index );
+        unix_face = unix_face_create( unix_name, NULL, 0, face_index, flags );
+        cache->dirty = TRUE;
+    }
+    font_dir_cache_add( cache, unix_name, face_index, unix_face );
+    return unix_face;
+}
+
+static void fontconfig_add_font( FcPattern *pattern, UINT flags, struct font_dir_cache *cache )
 {
     const char *unix_name, *format;
+    struct unix_face *unix_face;
     WCHAR *dos_name;
     FcBool scalable;
     DWORD aa_flags;
@@ -1572,9 +1869,12 @@ static void fontconfig_add_font( FcPattern *pattern, UINT flags )
     if (pFcPatternGetInteger( pattern, FC_INDEX, 0, &face_index ) != FcResultMatch)
         face_index = 0;
 
+    if (!(unix_face = font_dir_cache_get_face( cache, unix_name, face_index, flags ))) return;
+
     dos_name = get_dos_file_name( unix_name );
-    add_unix_face( unix_name, dos_name, NULL, 0, face_index, flags, NULL );
+    add_gdi_unix_face( unix_face, unix_name, dos_name, NULL, 0, face_index, flags );
     free( dos_name );
+    unix_face_destroy( unix_face );
 }
 
 static void init_fontconfig(void)
@@ -1643,6 +1943,7 @@ static void fontconfig_add_fonts_from_dir_list( FcConfig *config, FcStrList *dir
     FcStrList *subdir_list = NULL;
     FcStrSet *subdir_set = NULL;
     FcCache *cache = NULL;
+    struct font_dir_cache dir_cache;
     int i;
 
     TRACE( "(%p %p %p %#x)\n", config, dir_list, done_set, flags );
@@ -1655,8 +1956,10 @@ static void fontconfig_add_fonts_from_dir_list( FcConfig *config, FcStrList *dir
         if (!(cache = pFcDirCacheRead( dir, FcFalse, config ))) continue;
 
         if (!(font_set = pFcCacheCopySet( cache ))) goto done;
+        font_dir_cache_init( &dir_cache, (const char *)dir );
         for (i = 0; i < font_set->nfont; i++)
-            fontconfig_add_font( font_set->fonts[i], flags );
+            fontconfig_add_font( font_set->fonts[i], flags, &dir_cache );
+        font_dir_cache_release( &dir_cache );
         pFcFontSetDestroy( font_set );
         font_set = NULL;
 
@@ -1692,9 +1995,13 @@ static void load_fontconfig_fonts( void )
     if (!(done_set = pFcStrSetCreate())) goto done;
     if (!(dir_list = pFcConfigGetFontDirs( config ))) goto done;
 
+    font_dir_cache_key = reg_create_ascii_key( hkcu_key, "Software\\Wine\\Fonts\\Directories", 0, NULL );
+
     fontconfig_add_fonts_from_dir_list( config, dir_list, done_set, ADDFONT_EXTERNAL_FONT );
 
 done:
+    if (font_dir_cache_key) NtClose( font_dir_cache_key );
+    font_dir_cache_key = 0;
     if (dir_list) pFcStrListDone( dir_list );
     if (done_set) pFcStrSetDestroy( done_set );
 }
@@ -79,6 +79,7 @@ typedef struct FormatConverter {
     WICBitmapDitherType dither;
     double alpha_threshold;
     IWICPalette *palette;
+    struct palette_cache *palette_cache;
     CRITICAL_SECTION lock; /* must be held when initialized */
 } FormatConverter;
 
@@ -1438,6 +1439,39 @@ static UINT rgb_to_palette_index(BYTE bgr[3], WICColor *colors, UINT count)
     return best_index;
 }
 
+/* Images usually reuse a small set of colors, so remember the result of the
+ * nearest color search in a small direct-mapped table keyed by the color. */
+#define PALETTE_CACHE_SIZE 4096
+
+struct palette_cache
+{
+    WICColor colors[256]; /* palette the cached indices refer to */
+    UINT count;
+    DWORD key[PALETTE_CACHE_SIZE];
+    BYTE index[PALETTE_CACHE_SIZE];
+};
+
+static void reset_palette_cache(struct palette_cache *cache, const WICColor *colors, UINT count)
+{
+    memcpy(cache->colors, colors, count * sizeof(*colors));
+    cache->count = count;
+    /* no valid key has the high byte set */
+    memset(cache->key, 0xff, sizeof(cache->key));
+}
+
+static UINT cached_rgb_to_palette_index(struct palette_cache *cache, BYTE bgr[3], WICColor *colors, UINT count)
+{
+    DWORD key = bgr[0] | (bgr[1] << 8) | (bgr[2] << 16);
+    UINT slot = ((key * 0x9e3779b1) >> 20) & (PALETTE_CACHE_SIZE - 1);
+
+    if (cache->key[slot] != key)
+    {
+        cache->index[slot] = rgb_to_palette_index(bgr, colors, count);
+        cache->key[slot] = key;
+    }
+    return cache->index[slot];
+}
+
 static HRESULT copypixels_to_8bppIndexed(struct FormatConverter *This, const WICRect *prc,
     UINT cbStride, UINT cbBufferSize, BYTE *pbBuffer, enum pixelformat source_format)
 {
@@ -1471,21 +1505,42 @@ static HRESULT copypixels_to_8bppIndexed(struct FormatConverter *This, const WIC
     hr = copypixels_to_24bppBGR(This, prc, srcstride, srcdatasize, srcdata, source_format);
     if (SUCCEEDED(hr))
     {
+        struct palette_cache *cache;
         INT x, y;
         BYTE *src = srcdata, *dst = pbBuffer;
 
+        EnterCriticalSection(&This->lock);
+
+        if (!This->palette_cache)
+        {
+            if (!(This->palette_cache = malloc(sizeof(*This->palette_cache))))
+            {
+                LeaveCriticalSection(&This->lock);
+                free(srcdata);
+                return E_OUTOFMEMORY;
+            }
+            This->palette_cache->count = ~0u;
+        }
+        cache = This->palette_cache;
+
+        /* the palette object may have been modified since the last call */
+        if (cache->count != count || memcmp(cache->colors, colors, count * sizeof(*colors)))
+            reset_palette_cache(cache, colors, count);
+
         for (y = 0; y < prc->Height; y++)
         {
             BYTE *bgr = src;
 
             for (x = 0; x < prc->Width; x++)
             {
-                dst[x] = rgb_to_palette_index(bgr, colors, count);
+                dst[x] = cached_rgb_to_palette_index(cache, bgr, colors, count);
                 bgr += 3;
             }
             src += srcstride;
             dst += cbStride;
         }
+
+        LeaveCriticalSection(&This->lock);
     }
 
     free(srcdata);
@@ -1700,6 +1755,7 @@ static ULONG WINAPI FormatConverter_Release(IWICFormatConverter *iface)
         DeleteCriticalSection(&This->lock);
         if (This->source) IWICBitmapSource_Release(This->source);
         if (This->palette) IWICPalette_Release(This->palette);
+        free(This->palette_cache);
         free(This);
     }
 
@@ -1883,6 +1939,8 @@ static HRESULT WINAPI FormatConverter_Initialize(IWICFormatConverter *iface,
         This->dither = dither;
         This->alpha_threshold = alpha_threshold;
         This->palette = palette;
+        free(This->palette_cache);
+        This->palette_cache = NULL;
         This->source = source;
     }
     else
@@ -1966,6 +2024,7 @@ HRESULT FormatConverter_CreateInstance(REFIID iid, void** ppv)
     This->ref = 1;
     This->source = NULL;
     This->palette = NULL;
+    This->palette_cache = NULL;
     InitializeCriticalSectionEx(&This->lock, 0, RTL_CRITICAL_SECTION_FLAG_FORCE_DEBUG_INFO);
     This->lock.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": FormatConverter.lock");
 
@@ -69,6 +69,19 @@ static void emit_message_fn(j_common_ptr cinfo, int msg_level)
     }
 }
 
+struct jpeg_band {
+    UINT first; /* first scanline held in data */
+    UINT rows; /* number of valid scanlines in data */
+    UINT last_used;
+    BYTE *data;
+};
+
+/* Scanlines are decoded on demand into a few recently used bands instead of
+ * decoding the whole image up front. Rows requested before the current
+ * decoder position fall back to decoding the whole image once. */
+#define JPEG_BAND_ROWS 16
+#define JPEG_BAND_COUNT 4
+
 struct jpeg_decoder {
     struct decoder decoder;
     struct decoder_frame frame;
@@ -78,7 +91,15 @@ struct jpeg_decoder {
     struct jpeg_error_mgr jerr;
     struct jpeg_source_mgr source_mgr;
     BYTE source_buffer[1024];
+    ULONGLONG source_pos; /* stream offset of the data following source_buffer */
+    J_COLOR_SPACE out_color_space;
+    BOOL restart; /* decompression must start over from the beginning */
     UINT stride;
+    UINT band_size; /* capacity of each band in scanlines */
+    UINT band_clock;
+    struct jpeg_band bands[JPEG_BAND_COUNT];
+    BYTE *band_data;
+    BOOL image_valid;
     BYTE *image_data;
 };
 
@@ -97,6 +118,7 @@ static void CDECL jpeg_decoder_destroy(struct decoder* iface)
     struct jpeg_decoder *This = impl_from_decoder(iface);
 
     if (This->cinfo_initialized) jpeg_destroy_decompress(&This->cinfo);
+    free(This->band_data);
     free(This->image_data);
     free(This);
 }
@@ -111,7 +133,10 @@ static boolean source_mgr_fill_input_buffer(j_decompress_ptr cinfo)
     HRESULT hr;
     ULONG bytesread;
 
-    hr = stream_read(This->stream, This->source_buffer, 1024, &bytesread);
+    /* other users of the stream may have moved its position since the last read */
+    hr = stream_seek(This->stream, This->source_pos, STREAM_SEEK_SET, NULL);
+    if (SUCCEEDED(hr))
+        hr = stream_read(This->stream, This->source_buffer, 1024, &bytesread);
 
     if (FAILED(hr) || bytesread == 0)
     {
@@ -119,6 +144,7 @@ static boolean source_mgr_fill_input_buffer(j_decompress_ptr cinfo)
     }
     else
     {
+        This->source_pos += bytesread;
         This->source_mgr.next_input_byte = This->source_buffer;
         This->source_mgr.bytes_in_buffer = bytesread;
         return TRUE;
@@ -131,7 +157,7 @@ static void source_mgr_skip_input_data(j_decompress_ptr cinfo, long num_bytes)
 
     if (num_bytes > This->source_mgr.bytes_in_buffer)
     {
-        stream_seek(This->stream, num_bytes - This->source_mgr.bytes_in_buffer, STREAM_SEEK_CUR, NULL);
+        This->source_pos += num_bytes - This->source_mgr.bytes_in_buffer;
         This->source_mgr.bytes_in_buffer = 0;
     }
     else if (num_bytes > 0)
@@ -149,8 +175,8 @@ static HRESULT CDECL jpeg_decoder_initialize(struct decoder* iface, IStream *str
 {
     struct jpeg_decoder *This = impl_from_decoder(iface);
     int ret;
+    UINT i;
     jmp_buf jmpbuf;
-    UINT data_size, i;
 
     if (This->cinfo_initialized)
         return WINCODEC_ERR_WRONGSTATE;
@@ -172,8 +198,7 @@ static HRESULT CDECL jpeg_decoder_initialize(struct decoder* iface, IStream *str
     This->cinfo_initialized = TRUE;
 
     This->stream = stream;
-
-    stream_seek(This->stream, 0, STREAM_SEEK_SET, NULL);
+    This->source_pos = 0;
 
     This->source_mgr.bytes_in_buffer = 0;
     This->source_mgr.init_source = source_mgr_init_source;
@@ -214,6 +239,7 @@ static HRESULT CDECL jpeg_decoder_initialize(struct decoder* iface, IStream *str
         ERR("Unknown JPEG color space %i\n", This->cinfo.jpeg_color_space);
         return E_FAIL;
     }
+    This->out_color_space = This->cinfo.out_color_space;
 
     if (!jpeg_start_decompress(&This->cinfo))
     {
@@ -246,26 +272,78 @@ static HRESULT CDECL jpeg_decoder_initialize(struct decoder* iface, IStream *str
     This->frame.num_colors = 0;
 
     This->stride = (This->frame.bpp * This->cinfo.output_width + 7) / 8;
-    data_size = This->stride * This->cinfo.output_height;
+    This->band_size = max(JPEG_BAND_ROWS, This->cinfo.rec_outbuf_height);
 
-    if (data_size / This->stride < This->cinfo.output_height)
+    if ((This->stride * This->band_size) / This->band_size != This->stride ||
+        (This->stride * This->band_size * JPEG_BAND_COUNT) / JPEG_BAND_COUNT != This->stride * This->band_size)
         /* overflow in multiplication */
         return E_OUTOFMEMORY;
 
-    This->image_data = malloc(data_size);
-    if (!This->image_data)
+    This->band_data = malloc(This->stride * This->band_size * JPEG_BAND_COUNT);
+    if (!This->band_data)
         return E_OUTOFMEMORY;
 
-    while (This->cinfo.output_scanline < This->cinfo.output_height)
+    for (i=0; i<JPEG_BAND_COUNT; i++)
+    {
+        This->bands[i].first = This->bands[i].rows = This->bands[i].last_used = 0;
+        This->bands[i].data = This->band_data + This->stride * This->band_size * i;
+    }
+
+    st->frame_count = 1;
+    st->flags = WICBitmapDecoderCapabilityCanDecodeAllImages |
+                WICBitmapDecoderCapabilityCanDecodeSomeImages |
+                WICBitmapDecoderCapabilityCanEnumerateMetadata |
+                DECODER_FLAGS_UNSUPPORTED_COLOR_CONTEXT;
+    return S_OK;
+}
+
+static HRESULT CDECL jpeg_decoder_get_frame_info(struct decoder* iface, UINT frame, struct decoder_frame *info)
+{
+    struct jpeg_decoder *This = impl_from_decoder(iface);
+    *info = This->frame;
+    return S_OK;
+}
+
+/* must be called with a valid setjmp buffer in cinfo.client_data */
+static HRESULT jpeg_decoder_restart(struct jpeg_decoder *This)
+{
+    jpeg_abort_decompress(&This->cinfo);
+
+    This->source_pos = 0;
+    This->source_mgr.bytes_in_buffer = 0;
+
+    if (jpeg_read_header(&This->cinfo, TRUE) != JPEG_HEADER_OK)
+        return E_FAIL;
+
+    This->cinfo.out_color_space = This->out_color_space;
+
+    if (!jpeg_start_decompress(&This->cinfo))
+    {
+        ERR("jpeg_start_decompress failed\n");
+        return E_FAIL;
+    }
+
+    This->restart = FALSE;
+    return S_OK;
+}
+
+/* must be called with a valid setjmp buffer in cinfo.client_data */
+static HRESULT jpeg_decoder_read_rows(struct jpeg_decoder *This, BYTE *data, UINT count, UINT *rows)
+{
+    UINT i;
+
+    *rows = 0;
+
+    while (*rows < count && This->cinfo.output_scanline < This->cinfo.output_height)
     {
-        UINT first_scanline = This->cinfo.output_scanline;
         UINT max_rows;
         JSAMPROW out_rows[4];
         JDIMENSION ret;
 
-        max_rows = min(This->cinfo.output_height-first_scanline, 4);
+        max_rows = min(This->cinfo.output_height - This->cinfo.output_scanline, 4);
+        max_rows = min(count - *rows, max_rows);
         for (i=0; i<max_rows; i++)
-            out_rows[i] = This->image_data + This->stride * (first_scanline+i);
+            out_rows[i] = data + This->stride * (*rows + i);
 
         ret = jpeg_read_scanlines(&This->cinfo, out_rows, max_rows);
         if (ret == 0)
@@ -273,35 +351,81 @@ static HRESULT CDECL jpeg_decoder_initialize(struct decoder* iface, IStream *str
             ERR("read_scanlines failed\n");
             return E_FAIL;
         }
+        *rows += ret;
     }
 
     if (This->frame.bpp == 24)
     {
         /* libjpeg gives us RGB data and we want BGR, so byteswap the data */
-        reverse_bgr8(3, This->image_data,
-            This->cinfo.output_width, This->cinfo.output_height,
+        reverse_bgr8(3, data,
+            This->cinfo.output_width, *rows,
             This->stride);
     }
 
     if (This->cinfo.out_color_space == JCS_CMYK && This->cinfo.saw_Adobe_marker)
     {
         /* Adobe JPEG's have inverted CMYK data. */
-        for (i=0; i<data_size; i++)
-            This->image_data[i] ^= 0xff;
+        for (i=0; i<This->stride * *rows; i++)
+            data[i] ^= 0xff;
     }
 
-    st->frame_count = 1;
-    st->flags = WICBitmapDecoderCapabilityCanDecodeAllImages |
-                WICBitmapDecoderCapabilityCanDecodeSomeImages |
-                WICBitmapDecoderCapabilityCanEnumerateMetadata |
-                DECODER_FLAGS_UNSUPPORTED_COLOR_CONTEXT;
     return S_OK;
 }
 
-static HRESULT CDECL jpeg_decoder_get_frame_info(struct decoder* iface, UINT frame, struct decoder_frame *info)
+static struct jpeg_band *jpeg_decoder_find_band(struct jpeg_decoder *This, UINT y)
 {
-    struct jpeg_decoder *This = impl_from_decoder(iface);
-    *info = This->frame;
+    UINT i;
+
+    for (i=0; i<JPEG_BAND_COUNT; i++)
+    {
+        struct jpeg_band *band = &This->bands[i];
+        if (y >= band->first && y < band->first + band->rows)
+            return band;
+    }
+
+    return NULL;
+}
+
+/* must be called with a valid setjmp buffer in cinfo.client_data */
+static HRESULT jpeg_decoder_read_band(struct jpeg_decoder *This)
+{
+    struct jpeg_band *band = &This->bands[0];
+    UINT i;
+
+    for (i=1; i<JPEG_BAND_COUNT; i++)
+        if (This->bands[i].last_used < band->last_used) band = &This->bands[i];
+
+    band->first = This->cinfo.output_scanline;
+    band->rows = 0;
+    band->last_used = ++This->band_clock;
+
+    return jpeg_decoder_read_rows(This, band->data, This->band_size, &band->rows);
+}
+
+/* must be called with a valid setjmp buffer in cinfo.client_data */
+static HRESULT jpeg_decoder_decode_image(struct jpeg_decoder *This)
+{
+    UINT rows;
+    HRESULT hr;
+
+    if (!This->image_data)
+    {
+        if ((This->stride * This->cinfo.output_height) / This->cinfo.output_height != This->stride)
+            /* overflow in multiplication */
+            return E_OUTOFMEMORY;
+
+        This->image_data = malloc(This->stride * This->cinfo.output_height);
+        if (!This->image_data)
+            return E_OUTOFMEMORY;
+    }
+
+    if (FAILED(hr = jpeg_decoder_restart(This)))
+        return hr;
+
+    if (FAILED(hr = jpeg_decoder_read_rows(This, This->image_data, This->cinfo.output_height, &rows)))
+        return hr;
+
+    This->image_valid = TRUE;
     return S_OK;
 }
 
@@ -309,9 +433,60 @@ static HRESULT CDECL jpeg_decoder_copy_pixels(struct decoder* iface, UINT frame,
     const WICRect *prc, UINT stride, UINT buffersize, BYTE *buffer)
 {
     struct jpeg_decoder *This = impl_from_decoder(iface);
-    return copy_pixels(This->frame.bpp, This->image_data,
-        This->frame.width, This->frame.height, This->stride,
-        prc, stride, buffersize, buffer);
+    UINT bytesperrow = (This->frame.bpp * prc->Width + 7) / 8;
+    UINT offset = (This->frame.bpp * prc->X) / 8;
+    UINT y = prc->Y, end = prc->Y + prc->Height;
+    jmp_buf jmpbuf;
+    HRESULT hr;
+
+    This->cinfo.client_data = jmpbuf;
+
+    if (setjmp(jmpbuf))
+    {
+        This->restart = TRUE;
+        return E_FAIL;
+    }
+
+    while (y < end)
+    {
+        struct jpeg_band *band;
+
+        if (This->image_valid)
+        {
+            for (; y < end; y++)
+            {
+                memcpy(buffer, This->image_data + This->stride * y + offset, bytesperrow);
+                buffer += stride;
+            }
+            break;
+        }
+
+        if ((band = jpeg_decoder_find_band(This, y)))
+        {
+            UINT last = min(end, band->first + band->rows);
+
+            for (; y < last; y++)
+            {
+                memcpy(buffer, band->data + This->stride * (y - band->first) + offset, bytesperrow);
+                buffer += stride;
+            }
+            band->last_used = ++This->band_clock;
+            continue;
+        }
+
+        if (!This->restart && y >= This->cinfo.output_scanline)
+            hr = jpeg_decoder_read_band(This);
+        else if (y >= This->cinfo.output_scanline || FAILED(hr = jpeg_decoder_decode_image(This)))
+            hr = jpeg_decoder_restart(This);
+
+        if (FAILED(hr))
+        {
+            This->restart = TRUE;
+            return hr;
+        }
+    }
+
+    return S_OK;
 }
 
 static HRESULT CDECL jpeg_decoder_get_metadata_blocks(struct decoder* iface, UINT frame,
@@ -350,6 +525,10 @@ HRESULT CDECL jpeg_decoder_create(struct decoder_info *info, struct decoder **re
     This->decoder.vtable = &jpeg_decoder_vtable;
     This->cinfo_initialized = FALSE;
     This->stream = NULL;
+    This->restart = FALSE;
+    This->band_data = NULL;
+    This->band_clock = 0;
+    This->image_valid = FALSE;
     This->image_data = NULL;
     *result = &This->decoder;
 
@@ -203,6 +203,76 @@ static void NearestNeighbor_CopyScanline(BitmapScaler *This,
     }
 }
 
+static void Fant_GetSourceRange(UINT dst, UINT dst_size, UINT src_size, UINT *start, UINT *end)
+{
+    *start = (ULONGLONG)dst * src_size / dst_size;
+    *end = ((ULONGLONG)(dst + 1) * src_size + dst_size - 1) / dst_size;
+    if (*end <= *start) *end = *start + 1;
+    if (*end > src_size) *end = src_size;
+}
+
+static void Fant_GetRequiredSourceRect(BitmapScaler *This,
+    UINT x, UINT y, WICRect *src_rect)
+{
+    UINT start, end;
+
+    Fant_GetSourceRange(x, This->width, This->src_width, &start, &end);
+    src_rect->X = start;
+    src_rect->Width = end - start;
+    Fant_GetSourceRange(y, This->height, This->src_height, &start, &end);
+    src_rect->Y = start;
+    src_rect->Height = end - start;
+}
+
+/* Box filter: every destination pixel is the average of the source pixels it
+ * covers, which keeps downscaled images from aliasing. Only used for formats
+ * made of 8-bit channels. */
+static void Fant_CopyScanline(BitmapScaler *This,
+    UINT dst_x, UINT dst_y, UINT dst_width,
+    BYTE **src_data, UINT src_data_x, UINT src_data_y, BYTE *pbBuffer)
+{
+    UINT bytesperpixel = This->bpp/8;
+    UINT y_start, y_end, x_start, x_end;
+    UINT i, x, y, c;
+    ULONGLONG sum[4], count;
+
+    Fant_GetSourceRange(dst_y, This->height, This->src_height, &y_start, &y_end);
+
+    for (i=0; i<dst_width; i++)
+    {
+        Fant_GetSourceRange(dst_x + i, This->width, This->src_width, &x_start, &x_end);
+        count = (ULONGLONG)(x_end - x_start) * (y_end - y_start);
+
+        memset(sum, 0, sizeof(sum));
+        for (y=y_start; y<y_end; y++)
+        {
+            const BYTE *src = src_data[y - src_data_y] + bytesperpixel * (x_start - src_data_x);
+
+            for (x=x_start; x<x_end; x++)
+            {
+                for (c=0; c<bytesperpixel; c++)
+                    sum[c] += src[c];
+                src += bytesperpixel;
+            }
+        }
+
+        for (c=0; c<bytesperpixel; c++)
+            pbBuffer[bytesperpixel * i + c] = (sum[c] + count / 2) / count;
+    }
+}
+
+static BOOL is_fant_supported_format(const WICPixelFormatGUID *format)
+{
+    return IsEqualGUID(format, &GUID_WICPixelFormat8bppGray) ||
+           IsEqualGUID(format, &GUID_WICPixelFormat24bppBGR) ||
+           IsEqualGUID(format, &GUID_WICPixelFormat24bppRGB) ||
+           IsEqualGUID(format, &GUID_WICPixelFormat32bppBGR) ||
+           IsEqualGUID(format, &GUID_WICPixelFormat32bppBGRA) ||
+           IsEqualGUID(format, &GUID_WICPixelFormat32bppPBGRA) ||
+           IsEqualGUID(format, &GUID_WICPixelFormat32bppRGBA) ||
+           IsEqualGUID(format, &GUID_WICPixelFormat32bppPRGBA);
+}
+
 static HRESULT WINAPI BitmapScaler_CopyPixels(IWICBitmapScaler *iface,
     const WICRect *prc, UINT cbStride, UINT cbBufferSize, BYTE *pbBuffer)
 {
@@ -351,8 +421,20 @@ static HRESULT WINAPI BitmapScaler_Initialize(IWICBitmapScaler *iface,
     {
         switch (mode)
         {
+        case WICBitmapInterpolationModeFant:
+            if (is_fant_supported_format(&src_pixelformat))
+            {
+                IWICBitmapSource_AddRef(pISource);
+                This->source = pISource;
+                This->fn_get_required_source_rect = Fant_GetRequiredSourceRect;
+                This->fn_copy_scanline = Fant_CopyScanline;
+                break;
+            }
+            FIXME("unsupported pixel format %s for mode %i\n", debugstr_guid(&src_pixelformat), mode);
+            /* fall-through */
         default:
-            FIXME("unsupported mode %i\n", mode);
+            if (mode != WICBitmapInterpolationModeFant)
+                FIXME("unsupported mode %i\n", mode);
             /* fall-through */
         case WICBitmapInterpolationModeNearestNeighbor:
             if ((This->bpp % 8) == 0)
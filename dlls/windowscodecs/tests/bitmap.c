@@ -1318,6 +1318,42 @@ static void test_bitmap_scaler(void)
     IWICBitmap_Release(bitmap);
 }
 
+static void test_bitmap_scaler_fant(void)
+{
+    static const BYTE gray[] = { 10, 30, 50, 70,
+                                 10, 30, 50, 70 };
+    WICPixelFormatGUID pixel_format;
+    IWICBitmapScaler *scaler;
+    IWICBitmap *bitmap;
+    BYTE buf[2];
+    HRESULT hr;
+
+    hr = IWICImagingFactory_CreateBitmapFromMemory(factory, 4, 2, &GUID_WICPixelFormat8bppGray,
+        4, sizeof(gray), (BYTE *)gray, &bitmap);
+    ok(hr == S_OK, "Failed to create a bitmap, hr %#lx.\n", hr);
+
+    hr = IWICImagingFactory_CreateBitmapScaler(factory, &scaler);
+    ok(hr == S_OK, "Failed to create bitmap scaler, hr %#lx.\n", hr);
+
+    hr = IWICBitmapScaler_Initialize(scaler, (IWICBitmapSource *)bitmap, 2, 1,
+        WICBitmapInterpolationModeFant);
+    ok(hr == S_OK, "Failed to initialize bitmap scaler, hr %#lx.\n", hr);
+
+    memset(&pixel_format, 0, sizeof(pixel_format));
+    hr = IWICBitmapScaler_GetPixelFormat(scaler, &pixel_format);
+    ok(hr == S_OK, "Failed to get pixel format, hr %#lx.\n", hr);
+    ok(IsEqualGUID(&pixel_format, &GUID_WICPixelFormat8bppGray), "Unexpected pixel format %s.\n",
+        wine_dbgstr_guid(&pixel_format));
+
+    memset(buf, 0xcc, sizeof(buf));
+    hr = IWICBitmapScaler_CopyPixels(scaler, NULL, 2, sizeof(buf), buf);
+    ok(hr == S_OK, "Unexpected hr %#lx.\n", hr);
+    ok(buf[0] == 20 && buf[1] == 60, "Unexpected pixels %u,%u.\n", buf[0], buf[1]);
+
+    IWICBitmapScaler_Release(scaler);
+    IWICBitmap_Release(bitmap);
+}
+
 static LONG obj_refcount(void *obj)
 {
     IUnknown_AddRef((IUnknown *)obj);
@@ -1494,6 +1530,7 @@ START_TEST(bitmap)
     test_CreateBitmapFromHBITMAP();
     test_clipper();
     test_bitmap_scaler();
+    test_bitmap_scaler_fant();
 
     IWICImagingFactory_Release(factory);
 
@@ -56,6 +56,7 @@ static void test_decode_adobe_cmyk(void)
     GUID guidresult;
     UINT count=0, width=0, height=0;
     BYTE imagedata[5 * 4] = {1};
+    WICRect rc;
     UINT i;
 
     const BYTE expected_imagedata[5 * 4] = {
@@ -132,6 +133,27 @@ static void test_decode_adobe_cmyk(void)
                             "unexpected image data\n");
                 }
 
+                /* Partial rectangles, requested out of order */
+                rc.X = 0;
+                rc.Y = 3;
+                rc.Width = 1;
+                rc.Height = 2;
+                memset(imagedata, 0xcc, sizeof(imagedata));
+                hr = IWICBitmapFrameDecode_CopyPixels(framedecode, &rc, 4, sizeof(imagedata), imagedata);
+                ok(SUCCEEDED(hr), "CopyPixels failed, hr=%lx\n", hr);
+                ok(!memcmp(imagedata, expected_imagedata, 2 * 4) ||
+                        broken(!memcmp(imagedata, expected_imagedata_24bpp, 2 * 4)), /* xp/2003 */
+                        "unexpected image data\n");
+
+                rc.Y = 0;
+                rc.Height = 1;
+                memset(imagedata, 0xcc, sizeof(imagedata));
+                hr = IWICBitmapFrameDecode_CopyPixels(framedecode, &rc, 4, sizeof(imagedata), imagedata);
+                ok(SUCCEEDED(hr), "CopyPixels failed, hr=%lx\n", hr);
+                ok(!memcmp(imagedata, expected_imagedata, 4) ||
+                        broken(!memcmp(imagedata, expected_imagedata_24bpp, 4)), /* xp/2003 */
+                        "unexpected image data\n");
+
                 hr = IWICImagingFactory_CreatePalette(factory, &palette);
                 ok(SUCCEEDED(hr), "CreatePalette failed, hr=%lx\n", hr);
 
@@ -154,12 +176,130 @@ static void test_decode_adobe_cmyk(void)
     IWICImagingFactory_Release(factory);
 }
 
+/* expects an 8bpp gray image, so that width is also the stride in bytes */
+static void check_decoded_rows(IWICImagingFactory *factory, IStream *stream, const BYTE *expected,
+        UINT width, const UINT *order, UINT count)
+{
+    IWICBitmapDecoder *decoder;
+    IWICBitmapFrameDecode *framedecode;
+    LARGE_INTEGER pos;
+    BYTE row[64];
+    WICRect rc;
+    HRESULT hr;
+    UINT i;
+
+    pos.QuadPart = 0;
+    hr = IStream_Seek(stream, pos, STREAM_SEEK_SET, NULL);
+    ok(hr == S_OK, "Seek error %#lx\n", hr);
+
+    hr = IWICImagingFactory_CreateDecoderFromStream(factory, stream, NULL, WICDecodeMetadataCacheOnDemand, &decoder);
+    ok(hr == S_OK, "CreateDecoderFromStream error %#lx\n", hr);
+    hr = IWICBitmapDecoder_GetFrame(decoder, 0, &framedecode);
+    ok(hr == S_OK, "GetFrame error %#lx\n", hr);
+
+    rc.X = 0;
+    rc.Width = width;
+    rc.Height = 1;
+    for (i = 0; i < count; i++)
+    {
+        rc.Y = order[i];
+        memset(row, 0xcc, sizeof(row));
+        hr = IWICBitmapFrameDecode_CopyPixels(framedecode, &rc, sizeof(row), sizeof(row), row);
+        ok(hr == S_OK, "CopyPixels error %#lx\n", hr);
+        ok(!memcmp(row, expected + width * order[i], width), "unexpected data in row %u\n", order[i]);
+    }
+
+    IWICBitmapFrameDecode_Release(framedecode);
+    IWICBitmapDecoder_Release(decoder);
+}
+
+static void test_decode_rows(void)
+{
+    static const UINT width = 16, height = 96;
+    IWICImagingFactory *factory;
+    IWICBitmapEncoder *encoder;
+    IWICBitmapFrameEncode *frameencode;
+    IWICBitmapDecoder *decoder;
+    IWICBitmapFrameDecode *framedecode;
+    WICPixelFormatGUID format;
+    IStream *stream;
+    LARGE_INTEGER pos;
+    BYTE pixels[16 * 96], decoded[16 * 96];
+    UINT order[96], x, y;
+    HRESULT hr;
+
+    hr = CoCreateInstance(&CLSID_WICImagingFactory, NULL, CLSCTX_INPROC_SERVER,
+                          &IID_IWICImagingFactory, (void **)&factory);
+    ok(hr == S_OK, "CoCreateInstance error %#lx\n", hr);
+
+    for (y = 0; y < height; y++)
+        for (x = 0; x < width; x++)
+            pixels[y * width + x] = y * 2 + x;
+
+    hr = IWICImagingFactory_CreateEncoder(factory, &GUID_ContainerFormatJpeg, NULL, &encoder);
+    ok(hr == S_OK, "CreateEncoder error %#lx\n", hr);
+    hr = CreateStreamOnHGlobal(NULL, TRUE, &stream);
+    ok(hr == S_OK, "CreateStreamOnHGlobal error %#lx\n", hr);
+    hr = IWICBitmapEncoder_Initialize(encoder, stream, WICBitmapEncoderNoCache);
+    ok(hr == S_OK, "Initialize error %#lx\n", hr);
+    hr = IWICBitmapEncoder_CreateNewFrame(encoder, &frameencode, NULL);
+    ok(hr == S_OK, "CreateNewFrame error %#lx\n", hr);
+    hr = IWICBitmapFrameEncode_Initialize(frameencode, NULL);
+    ok(hr == S_OK, "Initialize error %#lx\n", hr);
+    hr = IWICBitmapFrameEncode_SetSize(frameencode, width, height);
+    ok(hr == S_OK, "SetSize error %#lx\n", hr);
+    format = GUID_WICPixelFormat8bppGray;
+    hr = IWICBitmapFrameEncode_SetPixelFormat(frameencode, &format);
+    ok(hr == S_OK, "SetPixelFormat error %#lx\n", hr);
+    ok(IsEqualGUID(&format, &GUID_WICPixelFormat8bppGray), "unexpected pixel format %s\n", wine_dbgstr_guid(&format));
+    hr = IWICBitmapFrameEncode_WritePixels(frameencode, height, width, sizeof(pixels), pixels);
+    ok(hr == S_OK, "WritePixels error %#lx\n", hr);
+    hr = IWICBitmapFrameEncode_Commit(frameencode);
+    ok(hr == S_OK, "Commit error %#lx\n", hr);
+    hr = IWICBitmapEncoder_Commit(encoder);
+    ok(hr == S_OK, "Commit error %#lx\n", hr);
+    IWICBitmapFrameEncode_Release(frameencode);
+    IWICBitmapEncoder_Release(encoder);
+
+    pos.QuadPart = 0;
+    hr = IStream_Seek(stream, pos, STREAM_SEEK_SET, NULL);
+    ok(hr == S_OK, "Seek error %#lx\n", hr);
+
+    hr = IWICImagingFactory_CreateDecoderFromStream(factory, stream, NULL, WICDecodeMetadataCacheOnDemand, &decoder);
+    ok(hr == S_OK, "CreateDecoderFromStream error %#lx\n", hr);
+    hr = IWICBitmapDecoder_GetFrame(decoder, 0, &framedecode);
+    ok(hr == S_OK, "GetFrame error %#lx\n", hr);
+    hr = IWICBitmapFrameDecode_GetPixelFormat(framedecode, &format);
+    ok(hr == S_OK, "GetPixelFormat error %#lx\n", hr);
+    ok(IsEqualGUID(&format, &GUID_WICPixelFormat8bppGray), "unexpected pixel format %s\n", wine_dbgstr_guid(&format));
+    hr = IWICBitmapFrameDecode_CopyPixels(framedecode, NULL, width, sizeof(decoded), decoded);
+    ok(hr == S_OK, "CopyPixels error %#lx\n", hr);
+    IWICBitmapFrameDecode_Release(framedecode);
+    IWICBitmapDecoder_Release(decoder);
+
+    for (y = 1; y < height; y++)
+        ok(memcmp(decoded + width * y, decoded + width * (y - 1), width), "rows %u and %u are identical\n", y - 1, y);
+
+    /* bottom-up, as used for vertical flips */
+    for (y = 0; y < height; y++)
+        order[y] = height - 1 - y;
+    check_decoded_rows(factory, stream, decoded, width, order, height);
+
+    /* scattered across bands */
+    for (y = 0; y < height; y++)
+        order[y] = (y * 37) % height;
+    check_decoded_rows(factory, stream, decoded, width, order, height);
+
+    IStream_Release(stream);
+    IWICImagingFactory_Release(factory);
+}
 
 START_TEST(jpegformat)
 {
     CoInitializeEx(NULL, COINIT_APARTMENTTHREADED);
 
     test_decode_adobe_cmyk();
+    test_decode_rows();
 
     CoUninitialize();
 }
@@ -402,6 +402,83 @@ static void get_physical_device_info(const struct wined3d_adapter_vk *adapter_vk
         VK_CALL(vkGetPhysicalDeviceFeatures(physical_device, &features2->features));
 }
 
+static void wined3d_device_vk_create_pipeline_cache(struct wined3d_device_vk *device_vk)
+{
+    const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
+    VkPipelineCacheCreateInfo cache_info;
+    const char *path;
+    void *data = NULL;
+    DWORD size = 0;
+    HANDLE file;
+    VkResult vr;
+
+    /* The driver validates the header of the initial data and ignores it if
+     * it was created by a different device or driver version. */
+    if ((path = wined3d_settings.vk_pipeline_cache)
+            && (file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+            OPEN_EXISTING, 0, NULL)) != INVALID_HANDLE_VALUE)
+    {
+        if ((size = GetFileSize(file, NULL)) != INVALID_FILE_SIZE && (data = malloc(size)))
+        {
+            if (!ReadFile(file, data, size, &size, NULL))
+                size = 0;
+        }
+        else
+        {
+            size = 0;
+        }
+        CloseHandle(file);
+        TRACE("Loaded %lu bytes of pipeline cache data from %s.\n", size, debugstr_a(path));
+    }
+
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.pNext = NULL;
+    cache_info.flags = 0;
+    cache_info.initialDataSize = size;
+    cache_info.pInitialData = data;
+    if ((vr = VK_CALL(vkCreatePipelineCache(device_vk->vk_device, &cache_info, NULL, &device_vk->vk_pipeline_cache))) < 0)
+    {
+        WARN("Failed to create pipeline cache, vr %s.\n", wined3d_debug_vkresult(vr));
+        device_vk->vk_pipeline_cache = VK_NULL_HANDLE;
+    }
+
+    free(data);
+}
+
+static void wined3d_device_vk_destroy_pipeline_cache(struct wined3d_device_vk *device_vk)
+{
+    const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
+    const char *path = wined3d_settings.vk_pipeline_cache;
+    void *data = NULL;
+    size_t size = 0;
+    HANDLE file;
+    DWORD written;
+
+    if (!device_vk->vk_pipeline_cache)
+        return;
+
+    if (path && VK_CALL(vkGetPipelineCacheData(device_vk->vk_device,
+            device_vk->vk_pipeline_cache, &size, NULL)) == VK_SUCCESS && size && size <= ~0u
+            && (data = malloc(size)) && VK_CALL(vkGetPipelineCacheData(device_vk->vk_device,
+            device_vk->vk_pipeline_cache, &size, data)) == VK_SUCCESS)
+    {
+        if ((file = CreateFileA(path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, 0, NULL)) != INVALID_HANDLE_VALUE)
+        {
+            if (!WriteFile(file, data, size, &written, NULL) || written != size)
+                WARN("Failed to write pipeline cache data to %s.\n", debugstr_a(path));
+            CloseHandle(file);
+            TRACE("Saved %Iu bytes of pipeline cache data to %s.\n", size, debugstr_a(path));
+        }
+        else
+        {
+            WARN("Failed to create pipeline cache file %s, error %lu.\n", debugstr_a(path), GetLastError());
+        }
+    }
+    free(data);
+
+    VK_CALL(vkDestroyPipelineCache(device_vk->vk_device, device_vk->vk_pipeline_cache, NULL));
+}
+
 static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wined3d_adapter *adapter,
         enum wined3d_device_type device_type, HWND focus_window, unsigned int flags, BYTE surface_alignment,
         const enum wined3d_feature_level *levels, unsigned int level_count,
@@ -477,6 +554,8 @@ static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wi
 #undef VK_DEVICE_EXT_PFN
 #undef VK_DEVICE_PFN
 
+    wined3d_device_vk_create_pipeline_cache(device_vk);
+
     if (!wined3d_allocator_init(&device_vk->allocator,
             adapter_vk->memory_properties.memoryTypeCount, &wined3d_allocator_vk_ops))
     {
@@ -500,6 +579,8 @@ static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wi
     return WINED3D_OK;
 
 fail:
+    if (device_vk->vk_pipeline_cache)
+        device_vk->vk_info.vk_ops.vkDestroyPipelineCache(vk_device, device_vk->vk_pipeline_cache, NULL);
     VK_CALL(vkDestroyDevice(vk_device, NULL));
     free(device_vk);
     return hr;
@@ -515,6 +596,7 @@ static void adapter_vk_destroy_device(struct wined3d_device *device)
 
     wined3d_lock_cleanup(&device_vk->allocator_cs);
 
+    wined3d_device_vk_destroy_pipeline_cache(device_vk);
     VK_CALL(vkDestroyDevice(device_vk->vk_device, NULL));
     free(device_vk);
 }
@@ -20,6 +20,7 @@
 #include "wined3d_gl.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(d3d);
+WINE_DECLARE_DEBUG_CHANNEL(d3d_cs);
 WINE_DECLARE_DEBUG_CHANNEL(d3d_perf);
 WINE_DECLARE_DEBUG_CHANNEL(d3d_sync);
 WINE_DECLARE_DEBUG_CHANNEL(fps);
@@ -635,6 +636,43 @@ static void wined3d_cs_exec_nop(struct wined3d_cs *cs, const void *data)
 {
 }
 
+/* Per-op execution statistics, collected while the d3d_cs channel is traced.
+ * Only accessed from the CS thread. */
+struct wined3d_cs_op_stats
+{
+    struct
+    {
+        unsigned int count;
+        uint64_t time;
+    } ops[WINED3D_CS_OP_STOP];
+};
+
+static void wined3d_cs_stats_add(uint64_t *counter, uint64_t value)
+{
+    InterlockedExchangeAdd64((LONG64 *)counter, value);
+}
+
+static uint64_t wined3d_cs_stats_read(uint64_t *counter)
+{
+    return InterlockedCompareExchange64((LONG64 *)counter, 0, 0);
+}
+
+static void wined3d_cs_stats_max(unsigned int *max, unsigned int value)
+{
+    unsigned int old;
+
+    while (value > (old = *(volatile unsigned int *)max))
+    {
+        if (InterlockedCompareExchange((LONG *)max, value, old) == old)
+            break;
+    }
+}
+
+/* Report the command stream statistics every this many presented frames. */
+#define WINED3D_CS_STATS_FRAME_INTERVAL 60u
+
+static void wined3d_cs_report_stats(struct wined3d_cs *cs);
+
 static void wined3d_cs_exec_present(struct wined3d_cs *cs, const void *data)
 {
     static LARGE_INTEGER freq;
@@ -691,6 +729,12 @@ static void wined3d_cs_exec_present(struct wined3d_cs *cs, const void *data)
 
     swapchain->swapchain_ops->swapchain_present(swapchain, &op->src_rect, &op->dst_rect, op->swap_interval, op->flags);
 
+    if (TRACE_ON(d3d_cs))
+    {
+        ++cs->stats.frame_count;
+        wined3d_cs_report_stats(cs);
+    }
+
     /* Discard buffers if the swap effect allows it. */
     back_buffer = swapchain->back_buffers[desc->backbuffer_count - 1];
     if (desc->swap_effect == WINED3D_SWAP_EFFECT_DISCARD || desc->swap_effect == WINED3D_SWAP_EFFECT_FLIP_DISCARD)
@@ -2668,6 +2712,15 @@ static void wined3d_cs_exec_update_sub_resource(struct wined3d_cs *cs, const voi
     const struct wined3d_box *box = &op->box;
     struct wined3d_context *context;
 
+    if (TRACE_ON(d3d_cs))
+    {
+        if (resource->type == WINED3D_RTYPE_BUFFER)
+            cs->stats.upload_bytes += box->right - box->left;
+        else
+            cs->stats.upload_bytes += wined3d_format_calculate_size(resource->format, 1, box->right - box->left,
+                    box->bottom - box->top, box->back - box->front);
+    }
+
     context = context_acquire(cs->c.device, NULL, 0);
 
     if (resource->type == WINED3D_RTYPE_BUFFER)
@@ -3156,6 +3209,16 @@ static void wined3d_cs_queue_submit(struct wined3d_cs_queue *queue, struct wined
     packet_size = FIELD_OFFSET(struct wined3d_cs_packet, data[packet->size]);
     InterlockedExchange((LONG *)&queue->head, queue->head + packet_size);
 
+    if (TRACE_ON(d3d_cs))
+    {
+        struct wined3d_cs_stats *stats = &cs->stats;
+        unsigned int depth = queue->head - *(volatile ULONG *)&queue->tail;
+
+        wined3d_cs_stats_add(&stats->producer.packet_count, 1);
+        wined3d_cs_stats_add(&stats->producer.packet_bytes, packet_size);
+        wined3d_cs_stats_max(&stats->max_queue_depth, depth);
+    }
+
     if (InterlockedCompareExchange(&cs->waiting_for_event, FALSE, TRUE))
     {
         if (pNtAlertThreadByThreadId)
@@ -3181,6 +3244,9 @@ static void *wined3d_cs_queue_require_space(struct wined3d_cs_queue *queue, size
     size_t header_size, packet_size, remaining;
     struct wined3d_cs_packet *packet;
     ULONG head = queue->head & WINED3D_CS_QUEUE_MASK;
+    BOOL trace_stats = TRACE_ON(d3d_cs);
+    unsigned int wait_spins = 0;
+    LARGE_INTEGER wait_start, wait_end;
 
     header_size = FIELD_OFFSET(struct wined3d_cs_packet, data[0]);
     packet_size = FIELD_OFFSET(struct wined3d_cs_packet, data[size]);
@@ -3229,6 +3295,21 @@ static void *wined3d_cs_queue_require_space(struct wined3d_cs_queue *queue, size
 
         TRACE_(d3d_perf)("Waiting for free space. Head %lu, tail %lu, packet size %Iu.\n",
                 head, tail, packet_size);
+        if (trace_stats)
+        {
+            if (!wait_spins++)
+            {
+                wined3d_cs_stats_add(&cs->stats.producer.space_wait_count, 1);
+                QueryPerformanceCounter(&wait_start);
+            }
+            wined3d_cs_stats_add(&cs->stats.producer.space_wait_spins, 1);
+        }
+    }
+
+    if (wait_spins)
+    {
+        QueryPerformanceCounter(&wait_end);
+        wined3d_cs_stats_add(&cs->stats.producer.space_wait_time, wait_end.QuadPart - wait_start.QuadPart);
     }
 
     packet = (struct wined3d_cs_packet *)&queue->data[head];
@@ -3250,15 +3331,26 @@ static void *wined3d_cs_mt_require_space(struct wined3d_device_context *context,
 static void wined3d_cs_mt_finish(struct wined3d_device_context *context, enum wined3d_cs_queue_id queue_id)
 {
     struct wined3d_cs *cs = wined3d_cs_from_context(context);
+    BOOL trace_stats = TRACE_ON(d3d_cs);
+    LARGE_INTEGER wait_start, wait_end;
     unsigned int spin_count = 0;
 
     if (cs->thread_id == GetCurrentThreadId())
         return wined3d_cs_st_finish(context, queue_id);
 
+    if (trace_stats)
+        QueryPerformanceCounter(&wait_start);
     TRACE_(d3d_perf)("Waiting for queue %u to be empty.\n", queue_id);
     while (cs->queue[queue_id].head != *(volatile ULONG *)&cs->queue[queue_id].tail)
         wined3d_pause(&spin_count);
     TRACE_(d3d_perf)("Queue is now empty.\n");
+    if (trace_stats)
+    {
+        QueryPerformanceCounter(&wait_end);
+        wined3d_cs_stats_add(&cs->stats.producer.finish_count, 1);
+        wined3d_cs_stats_add(&cs->stats.producer.finish_spins, spin_count);
+        wined3d_cs_stats_add(&cs->stats.producer.finish_time, wait_end.QuadPart - wait_start.QuadPart);
+    }
 }
 
 static const struct wined3d_device_context_ops wined3d_cs_mt_ops =
@@ -3311,6 +3403,9 @@ static void wined3d_cs_wait_event(struct wined3d_cs *cs)
             && InterlockedCompareExchange(&cs->waiting_for_event, FALSE, TRUE))
         return;
 
+    if (TRACE_ON(d3d_cs))
+        ++cs->stats.sleep_count;
+
     if (pNtWaitForAlertByThreadId)
         pNtWaitForAlertByThreadId(NULL, timeout);
     else
@@ -3350,9 +3445,25 @@ static inline bool wined3d_cs_execute_next(struct wined3d_cs *cs, struct wined3d
             return false;
         }
 
-        wined3d_cs_command_lock(cs);
-        wined3d_cs_op_handlers[opcode](cs, packet->data);
-        wined3d_cs_command_unlock(cs);
+        if (TRACE_ON(d3d_cs) && (cs->op_stats || (cs->op_stats = calloc(1, sizeof(*cs->op_stats)))))
+        {
+            LARGE_INTEGER start, end;
+
+            QueryPerformanceCounter(&start);
+            wined3d_cs_command_lock(cs);
+            wined3d_cs_op_handlers[opcode](cs, packet->data);
+            wined3d_cs_command_unlock(cs);
+            QueryPerformanceCounter(&end);
+
+            ++cs->op_stats->ops[opcode].count;
+            cs->op_stats->ops[opcode].time += end.QuadPart - start.QuadPart;
+        }
+        else
+        {
+            wined3d_cs_command_lock(cs);
+            wined3d_cs_op_handlers[opcode](cs, packet->data);
+            wined3d_cs_command_unlock(cs);
+        }
         TRACE("%s at %p executed.\n", debug_cs_op(opcode), packet);
     }
 
@@ -3389,10 +3500,79 @@ static void wined3d_cs_exec_execute_command_list(struct wined3d_cs *cs, const vo
     }
 }
 
+static void wined3d_cs_report_stats(struct wined3d_cs *cs)
+{
+    struct wined3d_cs_op_stats *op_stats = cs->op_stats;
+    struct wined3d_cs_stats *stats = &cs->stats;
+    struct wined3d_cs_producer_stats producer, *last = &stats->last_producer;
+    unsigned int time = GetTickCount(), max_queue_depth;
+    static LARGE_INTEGER freq;
+    unsigned int i;
+
+    /* Report every few frames, or every second if nothing is presented. */
+    if (stats->frame_count ? stats->frame_count < WINED3D_CS_STATS_FRAME_INTERVAL
+            : time - stats->last_report < 1000)
+        return;
+
+    if (!freq.QuadPart)
+        QueryPerformanceFrequency(&freq);
+
+    /* The producer counters are never reset, since the application threads
+     * may update them concurrently; report the difference from the previous
+     * snapshot instead. */
+    producer.packet_count = wined3d_cs_stats_read(&stats->producer.packet_count);
+    producer.packet_bytes = wined3d_cs_stats_read(&stats->producer.packet_bytes);
+    producer.space_wait_count = wined3d_cs_stats_read(&stats->producer.space_wait_count);
+    producer.space_wait_spins = wined3d_cs_stats_read(&stats->producer.space_wait_spins);
+    producer.space_wait_time = wined3d_cs_stats_read(&stats->producer.space_wait_time);
+    producer.finish_count = wined3d_cs_stats_read(&stats->producer.finish_count);
+    producer.finish_spins = wined3d_cs_stats_read(&stats->producer.finish_spins);
+    producer.finish_time = wined3d_cs_stats_read(&stats->producer.finish_time);
+    max_queue_depth = InterlockedExchange((LONG *)&stats->max_queue_depth, 0);
+
+    TRACE_(d3d_cs)("cs %p: %u frames in %u ms, %I64u bytes uploaded.\n",
+            cs, stats->frame_count, time - stats->last_report, stats->upload_bytes);
+    TRACE_(d3d_cs)("cs %p: %I64u packets (%I64u bytes) queued, %I64u executed, max queue depth %u bytes.\n",
+            cs, producer.packet_count - last->packet_count, producer.packet_bytes - last->packet_bytes,
+            stats->executed_count, max_queue_depth);
+    TRACE_(d3d_cs)("cs %p: %I64u waits for free space (%I64u spins, %I64u us), "
+            "%I64u waits for idle (%I64u spins, %I64u us).\n",
+            cs, producer.space_wait_count - last->space_wait_count,
+            producer.space_wait_spins - last->space_wait_spins,
+            (producer.space_wait_time - last->space_wait_time) * 1000000 / freq.QuadPart,
+            producer.finish_count - last->finish_count, producer.finish_spins - last->finish_spins,
+            (producer.finish_time - last->finish_time) * 1000000 / freq.QuadPart);
+    TRACE_(d3d_cs)("cs %p: %I64u idle spins (%I64u us), %u sleeps, spin count %u.\n",
+            cs, stats->idle_spins, stats->idle_time * 1000000 / freq.QuadPart,
+            stats->sleep_count, WINED3D_CS_SPIN_COUNT);
+
+    if (op_stats)
+    {
+        for (i = 0; i < ARRAY_SIZE(op_stats->ops); ++i)
+        {
+            if (!op_stats->ops[i].count)
+                continue;
+            TRACE_(d3d_cs)("cs %p: %s: %u ops, %I64u us.\n", cs, debug_cs_op(i),
+                    op_stats->ops[i].count, op_stats->ops[i].time * 1000000 / freq.QuadPart);
+        }
+        memset(op_stats, 0, sizeof(*op_stats));
+    }
+
+    *last = producer;
+    stats->executed_count = 0;
+    stats->idle_spins = 0;
+    stats->idle_time = 0;
+    stats->upload_bytes = 0;
+    stats->sleep_count = 0;
+    stats->frame_count = 0;
+    stats->last_report = time;
+}
+
 static DWORD WINAPI wined3d_cs_run(void *ctx)
 {
     struct wined3d_cs_queue *queue;
     unsigned int spin_count = 0;
+    LARGE_INTEGER idle_start = {0};
     struct wined3d_cs *cs = ctx;
     HMODULE wined3d_module;
     unsigned int poll = 0;
@@ -3415,6 +3595,9 @@ static DWORD WINAPI wined3d_cs_run(void *ctx)
             poll_queries(cs);
             wined3d_cs_command_unlock(cs);
             poll = 0;
+
+            if (TRACE_ON(d3d_cs))
+                wined3d_cs_report_stats(cs);
         }
 
         queue = &cs->queue[WINED3D_CS_QUEUE_MAP];
@@ -3424,6 +3607,12 @@ static DWORD WINAPI wined3d_cs_run(void *ctx)
             if (wined3d_cs_queue_is_empty(cs, queue))
             {
                 YieldProcessor();
+                if (TRACE_ON(d3d_cs))
+                {
+                    if (!spin_count)
+                        QueryPerformanceCounter(&idle_start);
+                    ++cs->stats.idle_spins;
+                }
                 if (++spin_count >= WINED3D_CS_SPIN_COUNT)
                 {
                     if (poll)
@@ -3434,9 +3623,19 @@ static DWORD WINAPI wined3d_cs_run(void *ctx)
                 continue;
             }
         }
+        if (idle_start.QuadPart)
+        {
+            LARGE_INTEGER idle_end;
+
+            QueryPerformanceCounter(&idle_end);
+            cs->stats.idle_time += idle_end.QuadPart - idle_start.QuadPart;
+            idle_start.QuadPart = 0;
+        }
         spin_count = 0;
 
         run = wined3d_cs_execute_next(cs, queue);
+        if (TRACE_ON(d3d_cs))
+            ++cs->stats.executed_count;
     }
 
     cs->queue[WINED3D_CS_QUEUE_MAP].tail = cs->queue[WINED3D_CS_QUEUE_MAP].head;
@@ -3583,6 +3782,7 @@ void wined3d_cs_destroy(struct wined3d_cs *cs)
 
     wined3d_state_destroy(cs->c.state);
     state_cleanup(&cs->state);
+    free(cs->op_stats);
     free(cs->data);
     free(cs);
 }
@@ -463,6 +463,16 @@ static BOOL wined3d_dll_init(HINSTANCE hInstDLL)
             TRACE("Forcing all constant buffers to be write-mappable.\n");
             wined3d_settings.cb_access_map_w = TRUE;
         }
+        if (!get_config_key(hkey, appkey, env, "VulkanPipelineCache", buffer, size))
+        {
+            size_t len = strlen(buffer) + 1;
+
+            if (!(wined3d_settings.vk_pipeline_cache = malloc(len)))
+                ERR("Failed to allocate pipeline cache path memory.\n");
+            else
+                memcpy(wined3d_settings.vk_pipeline_cache, buffer, len);
+            TRACE("Using Vulkan pipeline cache file %s.\n", debugstr_a(buffer));
+        }
     }
 
     if (appkey) RegCloseKey( appkey );
@@ -522,6 +532,7 @@ static BOOL wined3d_dll_destroy(HINSTANCE hInstDLL)
     free(swapchain_state_table.hooks);
 
     free(wined3d_settings.logo);
+    free(wined3d_settings.vk_pipeline_cache);
     UnregisterClassA(WINED3D_OPENGL_WINDOW_CLASS_NAME, hInstDLL);
 
     DeleteCriticalSection(&wined3d_command_cs);
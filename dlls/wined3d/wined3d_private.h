@@ -486,6 +486,7 @@ struct wined3d_settings
     enum wined3d_renderer renderer;
     enum wined3d_shader_backend shader_backend;
     BOOL cb_access_map_w;
+    char *vk_pipeline_cache;
 };
 
 extern struct wined3d_settings wined3d_settings;
@@ -3593,6 +3594,40 @@ struct wined3d_device_context
     struct wined3d_state *state;
 };
 
+/* Command stream queue statistics, collected while the d3d_cs channel is
+ * traced. Times are in performance counter ticks. */
+struct wined3d_cs_producer_stats
+{
+    uint64_t packet_count;
+    uint64_t packet_bytes;
+    uint64_t space_wait_count;
+    uint64_t space_wait_spins;
+    uint64_t space_wait_time;
+    uint64_t finish_count;
+    uint64_t finish_spins;
+    uint64_t finish_time;
+};
+
+struct wined3d_cs_stats
+{
+    /* Updated by the application threads with interlocked operations, and
+     * never reset; reports show the difference from "last_producer". */
+    struct wined3d_cs_producer_stats producer;
+    unsigned int max_queue_depth;
+
+    /* Only accessed from the CS thread. */
+    struct wined3d_cs_producer_stats last_producer;
+    uint64_t executed_count;
+    uint64_t idle_spins;
+    uint64_t idle_time;
+    uint64_t upload_bytes;
+    unsigned int sleep_count;
+    unsigned int frame_count;
+    unsigned int last_report;
+};
+
+struct wined3d_cs_op_stats;
+
 struct wined3d_cs
 {
     struct wined3d_device_context c;
@@ -3613,6 +3648,9 @@ struct wined3d_cs
     LONG waiting_for_event;
     LONG waiting_for_present;
     LONG pending_presents;
+
+    struct wined3d_cs_stats stats;
+    struct wined3d_cs_op_stats *op_stats;
 };
 
 static inline void wined3d_device_context_lock(struct wined3d_device_context *context)
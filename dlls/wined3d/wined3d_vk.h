@@ -829,6 +829,8 @@ struct wined3d_device_vk
 
     struct wined3d_vk_info vk_info;
 
+    VkPipelineCache vk_pipeline_cache;
+
     struct wined3d_null_resources_vk null_resources_vk;
     struct wined3d_null_views_vk null_views_vk;
 
@@ -26,6 +26,10 @@
 #include "setupapi.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(vulkan);
+WINE_DECLARE_DEBUG_CHANNEL(vkcalls);
+
+/* per entry point count of PE to Unix transitions, only allocated when tracing them */
+LONG *unix_call_counts;
 
 /* For now default to 4 as it felt like a reasonable version feature wise to support.
  * Version 5 adds more extensive version checks. Something to tackle later.
@@ -703,6 +707,49 @@ void WINAPI vkFreeCommandBuffers(VkDevice device, VkCommandPool cmd_pool, uint32
     }
 }
 
+/* trace and reset the per entry point counts, every 1.5 seconds when called on present */
+static void trace_unix_calls(BOOL present)
+{
+    static DWORD prev_time;
+    static unsigned long frames;
+    DWORD time = GetTickCount();
+    unsigned long total = 0;
+    unsigned int i;
+    LONG count;
+
+    if (present)
+    {
+        frames++;
+        if (time - prev_time <= 1500) return;
+    }
+
+    for (i = 0; i < unix_count; i++)
+    {
+        if (!(count = InterlockedExchange(&unix_call_counts[i], 0))) continue;
+        if (frames) TRACE_(vkcalls)("%s: %ld calls, %.1f per frame\n", unix_call_names[i], count, (double)count / frames);
+        else TRACE_(vkcalls)("%s: %ld calls\n", unix_call_names[i], count);
+        total += count;
+    }
+    if (frames) TRACE_(vkcalls)("@ %lu calls in %lu frames, %.1f per frame\n", total, frames, (double)total / frames);
+    else TRACE_(vkcalls)("@ %lu calls\n", total);
+
+    prev_time = time;
+    frames = 0;
+}
+
+VkResult WINAPI vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *present_info)
+{
+    struct vkQueuePresentKHR_params params;
+    NTSTATUS status;
+
+    params.queue = queue;
+    params.pPresentInfo = present_info;
+    status = UNIX_CALL(vkQueuePresentKHR, &params);
+    assert(!status && "vkQueuePresentKHR");
+    if (unix_call_counts) trace_unix_calls(TRUE);
+    return params.result;
+}
+
 BOOL WINAPI DllMain(HINSTANCE hinst, DWORD reason, void *reserved)
 {
     TRACE("%p, %lu, %p\n", hinst, reason, reserved);
@@ -712,6 +759,15 @@ BOOL WINAPI DllMain(HINSTANCE hinst, DWORD reason, void *reserved)
         case DLL_PROCESS_ATTACH:
             hinstance = hinst;
             DisableThreadLibraryCalls(hinst);
+            if (TRACE_ON(vkcalls)) unix_call_counts = calloc(unix_count, sizeof(*unix_call_counts));
+            break;
+
+        case DLL_PROCESS_DETACH:
+            if (!unix_call_counts) break;
+            trace_unix_calls(FALSE);
+            if (reserved) break;
+            free(unix_call_counts);
+            unix_call_counts = NULL;
             break;
     }
     return TRUE;
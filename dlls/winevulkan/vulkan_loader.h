@@ -183,6 +183,19 @@ struct is_available_device_function_params
     const char *name;
 };
 
-#define UNIX_CALL(code, params) WINE_UNIX_CALL(unix_ ## code, params)
+#ifndef WINE_UNIX_LIB
+
+extern const char * const unix_call_names[];
+extern LONG *unix_call_counts;
+
+static inline NTSTATUS counted_unix_call(unsigned int code, void *params)
+{
+    if (unix_call_counts) InterlockedIncrement(&unix_call_counts[code]);
+    return WINE_UNIX_CALL(code, params);
+}
+
+#define UNIX_CALL(code, params) counted_unix_call(unix_ ## code, params)
+
+#endif /* WINE_UNIX_LIB */
 
 #endif /* __WINE_VULKAN_LOADER_H */
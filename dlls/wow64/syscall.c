@@ -34,6 +34,7 @@
 #include "wine/debug.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(wow);
+WINE_DECLARE_DEBUG_CHANNEL(wow_perf);
 
 USHORT native_machine = 0;
 USHORT current_machine = 0;
@@ -62,6 +63,24 @@ static SYSTEM_SERVICE_TABLE syscall_tables[4] =
     { (ULONG_PTR *)syscall_thunks, NULL, ARRAY_SIZE(syscall_thunks), syscall_args }
 };
 
+static const char * const syscall_names[] =
+{
+#define SYSCALL_ENTRY(id,name,args) #name,
+    ALL_SYSCALLS32
+#undef SYSCALL_ENTRY
+};
+
+/* per syscall statistics, only allocated when the wow_perf channel is enabled */
+struct syscall_stats
+{
+    LONG   count;
+    LONG64 time;
+};
+
+static struct syscall_stats *syscall_stats[4];
+static LONG64 syscall_stats_report_time;
+static LARGE_INTEGER syscall_stats_freq;
+
 /* header for Wow64AllocTemp blocks; probably not the right layout */
 struct mem_header
 {
@@ -858,6 +877,19 @@ static DWORD WINAPI process_init( RTL_RUN_ONCE *once, void *param, void **contex
     if (wow64info->CpuFlags & WOW64_CPUFLAGS_SOFTWARE) create_cross_process_work_list( wow64info );
 
     init_file_redirects();
+
+    if (TRACE_ON(wow_perf))
+    {
+        unsigned int i;
+
+        RtlQueryPerformanceFrequency( &syscall_stats_freq );
+        for (i = 0; i < ARRAY_SIZE(syscall_tables); i++)
+        {
+            if (!syscall_tables[i].ServiceLimit) continue;
+            syscall_stats[i] = RtlAllocateHeap( GetProcessHeap(), HEAP_ZERO_MEMORY,
+                                                syscall_tables[i].ServiceLimit * sizeof(*syscall_stats[i]) );
+        }
+    }
     return TRUE;
 
 #undef GET_PTR
@@ -997,6 +1029,35 @@ __ASM_GLOBAL_FUNC( wow64_syscall_handler,
 #endif
 
 
+/**********************************************************************
+ *           report_syscall_stats
+ */
+static void report_syscall_stats( LONG64 now )
+{
+    LONG64 prev = syscall_stats_report_time, time;
+    unsigned int i, id;
+    LONG count;
+
+    /* every 5 seconds, from whichever thread gets there first */
+    if (now - prev < 5 * syscall_stats_freq.QuadPart) return;
+    if (InterlockedCompareExchange64( &syscall_stats_report_time, now, prev ) != prev) return;
+
+    for (i = 0; i < ARRAY_SIZE(syscall_stats); i++)
+    {
+        if (!syscall_stats[i]) continue;
+        for (id = 0; id < syscall_tables[i].ServiceLimit; id++)
+        {
+            if (!(count = InterlockedExchange( &syscall_stats[i][id].count, 0 ))) continue;
+            time = syscall_stats[i][id].time;
+            InterlockedExchangeAdd64( &syscall_stats[i][id].time, -time );
+            if (!i) TRACE_(wow_perf)( "%s: ", syscall_names[id] );
+            else TRACE_(wow_perf)( "%04x: ", (i << 12) | id );
+            TRACE_(wow_perf)( "%ld calls, %.3f ms\n", count, time * 1000.0 / syscall_stats_freq.QuadPart );
+        }
+    }
+}
+
+
 /**********************************************************************
  *           Wow64SystemServiceEx  (wow64.@)
  */
@@ -1005,14 +1066,24 @@ NTSTATUS WINAPI Wow64SystemServiceEx( UINT num, UINT *args )
     NTSTATUS status;
     UINT id = num & 0xfff;
     const SYSTEM_SERVICE_TABLE *table = &syscall_tables[(num >> 12) & 3];
+    struct syscall_stats *stats = syscall_stats[(num >> 12) & 3];
+    LARGE_INTEGER start, end;
 
     if (id >= table->ServiceLimit)
     {
         ERR( "unsupported syscall %04x\n", num );
         return STATUS_INVALID_SYSTEM_SERVICE;
     }
+    if (stats) RtlQueryPerformanceCounter( &start );
     status = wow64_syscall( args, table->ServiceTable[id] );
     free_temp_data();
+    if (stats)
+    {
+        RtlQueryPerformanceCounter( &end );
+        InterlockedIncrement( &stats[id].count );
+        InterlockedExchangeAdd64( &stats[id].time, end.QuadPart - start.QuadPart );
+        report_syscall_stats( end.QuadPart );
+    }
     return status;
 }
 
@@ -1007,15 +1007,37 @@ static void fixup_buffer_cr(encoded_buffer *buffer, int off)
     *dest = 0;
 }
 
+/* Appends 'len' bytes of multibyte input converted to UTF-16. None of the
+   supported code pages produce more than one WCHAR per input byte, so the
+   buffer is grown up front and the input is converted in a single pass. */
+static void readerinput_convert(xmlreaderinput *readerinput, UINT cp, const char *src, int len)
+{
+    encoded_buffer *dest = &readerinput->buffer->utf16;
+    int i = 0, dest_len;
+    WCHAR *ptr;
+
+    readerinput_grow(readerinput, len);
+    ptr = (WCHAR*)(dest->data + dest->written);
+
+    /* widen leading ASCII directly, it's what most UTF-8 documents consist of */
+    if (cp == CP_UTF8)
+        for (; i < len && !(src[i] & 0x80); i++) ptr[i] = src[i];
+
+    dest_len = i;
+    if (i < len)
+        dest_len += MultiByteToWideChar(cp, 0, src + i, len - i, ptr + i, len - i);
+    ptr[dest_len] = 0;
+    dest->written += dest_len * sizeof(WCHAR);
+}
+
 /* note that raw buffer content is kept */
 static void readerinput_switchencoding(xmlreaderinput *readerinput, xml_encoding enc)
 {
     encoded_buffer *src = &readerinput->buffer->encoded;
     encoded_buffer *dest = &readerinput->buffer->utf16;
-    int len, dest_len;
     UINT cp = ~0u;
     HRESULT hr;
-    WCHAR *ptr;
+    int len;
 
     hr = get_code_page(enc, &cp);
     if (FAILED(hr)) return;
@@ -1033,14 +1055,7 @@ static void readerinput_switchencoding(xmlreaderinput *readerinput, xml_encoding
         dest->written += len;
     }
     else
-    {
-        dest_len = MultiByteToWideChar(cp, 0, src->data + src->cur, len, NULL, 0);
-        readerinput_grow(readerinput, dest_len);
-        ptr = (WCHAR*)dest->data;
-        MultiByteToWideChar(cp, 0, src->data + src->cur, len, ptr, dest_len);
-        ptr[dest_len] = 0;
-        dest->written += dest_len*sizeof(WCHAR);
-    }
+        readerinput_convert(readerinput, cp, src->data + src->cur, len);
 
     fixup_buffer_cr(dest, 0);
 }
@@ -1068,9 +1083,8 @@ static HRESULT reader_more(xmlreader *reader)
     encoded_buffer *src = &readerinput->buffer->encoded;
     encoded_buffer *dest = &readerinput->buffer->utf16;
     UINT cp = readerinput->buffer->code_page;
-    int len, dest_len, prev_len;
+    int len, prev_len;
     HRESULT hr;
-    WCHAR *ptr;
 
     /* get some raw data from stream first */
     if (FAILED(hr = readerinput_growraw(readerinput)))
@@ -1088,12 +1102,7 @@ static HRESULT reader_more(xmlreader *reader)
     }
     else
     {
-        dest_len = MultiByteToWideChar(cp, 0, src->data + src->cur, len, NULL, 0);
-        readerinput_grow(readerinput, dest_len);
-        ptr = (WCHAR*)(dest->data + dest->written);
-        MultiByteToWideChar(cp, 0, src->data + src->cur, len, ptr, dest_len);
-        ptr[dest_len] = 0;
-        dest->written += dest_len*sizeof(WCHAR);
+        readerinput_convert(readerinput, cp, src->data + src->cur, len);
         /* get rid of processed data */
         readerinput_shrinkraw(readerinput, len);
     }